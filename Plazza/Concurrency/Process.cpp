@@ -2,6 +2,7 @@
 // Dependencies
 ///////////////////////////////////////////////////////////////////////////////
 #include "Concurrency/Process.hpp"
+#include "Utils/Logger.hpp"
 #include <stdexcept>
 #include <unistd.h>
 #include <sys/wait.h>
@@ -96,14 +97,17 @@ void Process::Start(void)
             {
                 m_function();
             }
+            Logger::Flush();
             _exit(0);
         }
         catch (const std::exception& e)
         {
+            Logger::Flush();
             _exit(1);
         }
         catch (...)
         {
+            Logger::Flush();
             _exit(2);
         }
     }
@@ -0,0 +1,81 @@
+///////////////////////////////////////////////////////////////////////////////
+// Dependencies
+///////////////////////////////////////////////////////////////////////////////
+#include "Concurrency/ThreadPool.hpp"
+#include <algorithm>
+
+///////////////////////////////////////////////////////////////////////////////
+// Namespace Plazza
+///////////////////////////////////////////////////////////////////////////////
+namespace Plazza
+{
+
+///////////////////////////////////////////////////////////////////////////////
+ThreadPool::ThreadPool(size_t size)
+    : m_stopping(false)
+{
+    for (size_t i = 0; i < std::max<size_t>(size, 1); i++)
+    {
+        m_workers.push_back(std::make_unique<Thread>(
+            [this]() { WorkerRoutine(); }
+        ));
+        m_workers.back()->Start();
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+ThreadPool::~ThreadPool()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stopping = true;
+    }
+    m_cv.NotifyAll();
+
+    for (auto& worker : m_workers)
+    {
+        worker->Join();
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void ThreadPool::WorkerRoutine(void)
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+
+    while (true)
+    {
+        m_cv.GetNativeHandle().wait(lock, [this]() {
+            return (m_stopping || !m_tasks.empty());
+        });
+        if (m_tasks.empty())
+        {
+            return;
+        }
+
+        std::function<void()> task = std::move(m_tasks.front());
+        m_tasks.pop_front();
+
+        lock.unlock();
+        task();
+        lock.lock();
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void ThreadPool::Submit(std::function<void()> task)
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_tasks.push_back(std::move(task));
+    }
+    m_cv.NotifyOne();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+size_t ThreadPool::GetSize(void) const
+{
+    return (m_workers.size());
+}
+
+} // !namespace Plazza
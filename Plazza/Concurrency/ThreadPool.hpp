@@ -0,0 +1,85 @@
+///////////////////////////////////////////////////////////////////////////////
+// Header guard
+///////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+///////////////////////////////////////////////////////////////////////////////
+// Dependencies
+///////////////////////////////////////////////////////////////////////////////
+#include "Concurrency/Thread.hpp"
+#include "Concurrency/Mutex.hpp"
+#include "Concurrency/CondVar.hpp"
+#include <deque>
+#include <functional>
+#include <memory>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+// Namespace Plazza
+///////////////////////////////////////////////////////////////////////////////
+namespace Plazza
+{
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Fixed set of threads running submitted tasks in FIFO order
+///
+///////////////////////////////////////////////////////////////////////////////
+class ThreadPool
+{
+private:
+    ///////////////////////////////////////////////////////////////////////////
+    //
+    ///////////////////////////////////////////////////////////////////////////
+    std::vector<std::unique_ptr<Thread>> m_workers; //<!
+    std::deque<std::function<void()>> m_tasks;      //<!
+    bool m_stopping;                                //<!
+    Mutex m_mutex;                                  //<!
+    CondVar m_cv;                                   //<!
+
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param size Number of threads, at least one
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    explicit ThreadPool(size_t size);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Run the tasks left, then join every thread
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    ~ThreadPool();
+
+    ///////////////////////////////////////////////////////////////////////////
+    //
+    ///////////////////////////////////////////////////////////////////////////
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+private:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void WorkerRoutine(void);
+
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Queue a task; it must not throw
+    ///
+    /// \param task
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void Submit(std::function<void()> task);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    size_t GetSize(void) const;
+};
+
+} // !namespace Plazza
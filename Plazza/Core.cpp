@@ -4,10 +4,14 @@
 #include "Core.hpp"
 #include "Errors/InvalidArgument.hpp"
 #include "Pizza/APizza.hpp"
+#include "Pizza/Recipe.hpp"
 #include "Utils/Logger.hpp"
+#include "Utils/Tracer.hpp"
 #include "Utils/Timer.hpp"
 #include <iostream>
 #include <algorithm>
+#include <csignal>
+#include <cstdlib>
 
 ///////////////////////////////////////////////////////////////////////////////
 // Namespace Plazza
@@ -17,23 +21,75 @@ namespace Plazza
 
 ///////////////////////////////////////////////////////////////////////////////
 Core::Core(int argc, char* argv[])
-    : m_initialized(false)
+    : m_dispatchPolicy(Reception::DispatchPolicy::GREEDY)
+    , m_poolMin(0)
+    , m_poolMax(0)
+    , m_idlePolicy{Milliseconds(5000), Milliseconds(0)}
+    , m_respawn(false)
+    , m_backlog(0)
+    , m_initialized(false)
 {
     ParseArguments(argc, argv);
 
     Logger::SetConsoleOutput(false);
     Logger::SetLogFile("plazza.log");
+    Logger::InstallCrashHandler();
+
+    // Before the zygote forks, so every kitchen writes its own segments
+    if (!m_logDirectory.empty())
+    {
+        Logger::SetBinaryOutput(m_logDirectory);
+    }
 
     Logger::Info("CORE", "Beginning of Plazza");
 
     Plazza::APizza::SetCookingTimeMultiplier(m_cookingTimeMultiplier);
 
+    // Kitchens are forked from the zygote and inherit the loaded menu
+    if (m_initialized && !m_menuPath.empty())
+    {
+        RecipeBook::LoadFile(m_menuPath);
+        Logger::Info("CORE", "Menu of {} pizza(s) loaded from {}",
+            RecipeBook::GetTypeNames().size(), m_menuPath);
+    }
+
+    // Must be on before the zygote forks so every kitchen inherits it
+    if (m_initialized && !m_traceDirectory.empty())
+    {
+        Tracer::Enable(m_traceDirectory);
+        Logger::Info("CORE", "Tracing into {}", m_traceDirectory);
+    }
+
+    // Forked before anything heavy exists, so kitchens start small
+    if (m_initialized)
+    {
+        m_zygote = std::make_unique<Zygote>();
+    }
+
+    // A dead kitchen must surface as EPIPE, not kill the Reception.
+    signal(SIGPIPE, SIG_IGN);
+
     m_reception = std::make_unique<Reception>(
         Milliseconds(m_restockTimeMs),
-        m_cooksPerKitchen
+        m_cooksPerKitchen,
+        m_dispatchPolicy,
+        m_poolMin,
+        m_poolMax,
+        m_idlePolicy,
+        m_respawn,
+        m_zygote.get()
     );
 
     m_cli = std::make_unique<CLI>(*m_reception);
+
+    if (m_metricsPort)
+    {
+        m_metrics = std::make_unique<MetricsServer>(m_metricsPort.value());
+    }
+    else if (!m_metricsSocket.empty())
+    {
+        m_metrics = std::make_unique<MetricsServer>(m_metricsSocket);
+    }
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -44,13 +100,24 @@ void Core::PrintUsage(const std::string& arg0)
               << " <multiplier>"
               << " <cooks_per_kitchen>"
               << " <restock_time_ms>"
+              << " [--dispatch greedy|earliest]"
+              << " [--pool-min N]"
+              << " [--pool-max N]"
+              << " [--idle-timeout MS]"
+              << " [--hibernate-ttl MS]"
+              << " [--respawn]"
+              << " [--trace DIR]"
+              << " [--log-binary DIR]"
+              << " [--metrics-port PORT | --metrics-socket PATH]"
+              << " [--orders FILE|- [--backlog N]]"
+              << " [--menu FILE]"
               << std::endl;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
 void Core::ParseArguments(int argc, char* argv[])
 {
-    if (argc != 4)
+    if (argc < 4)
     {
         return (PrintUsage(argv[0]));
     }
@@ -89,9 +156,114 @@ void Core::ParseArguments(int argc, char* argv[])
         throw InvalidArgument("Ingredient restock time must be positive.");
     }
 
+    if (const char* directory = std::getenv("PLAZZA_TRACE"))
+    {
+        m_traceDirectory = directory;
+    }
+    if (const char* directory = std::getenv("PLAZZA_LOG_BINARY"))
+    {
+        m_logDirectory = directory;
+    }
+
+    for (int i = 4; i < argc; i++)
+    {
+        std::string option = argv[i];
+
+        if (option == "--dispatch" && i + 1 < argc)
+        {
+            m_dispatchPolicy = Reception::ParseDispatchPolicy(argv[++i]);
+        }
+        else if (option == "--pool-min" && i + 1 < argc)
+        {
+            m_poolMin = ParseCount(option, argv[++i]);
+        }
+        else if (option == "--pool-max" && i + 1 < argc)
+        {
+            m_poolMax = ParseCount(option, argv[++i]);
+        }
+        else if (option == "--idle-timeout" && i + 1 < argc)
+        {
+            m_idlePolicy.idleTimeout = Milliseconds(
+                ParseCount(option, argv[++i])
+            );
+        }
+        else if (option == "--respawn")
+        {
+            m_respawn = true;
+        }
+        else if (option == "--hibernate-ttl" && i + 1 < argc)
+        {
+            m_idlePolicy.hibernationTtl = Milliseconds(
+                ParseCount(option, argv[++i])
+            );
+        }
+        else if (option == "--trace" && i + 1 < argc)
+        {
+            m_traceDirectory = argv[++i];
+        }
+        else if (option == "--log-binary" && i + 1 < argc)
+        {
+            m_logDirectory = argv[++i];
+        }
+        else if (option == "--metrics-port" && i + 1 < argc)
+        {
+            size_t port = ParseCount(option, argv[++i]);
+            if (port == 0 || port > 65535)
+            {
+                throw InvalidArgument("Invalid " + option + " value: " + argv[i]);
+            }
+            m_metricsPort = static_cast<uint16_t>(port);
+        }
+        else if (option == "--metrics-socket" && i + 1 < argc)
+        {
+            m_metricsSocket = argv[++i];
+        }
+        else if (option == "--orders" && i + 1 < argc)
+        {
+            m_ordersPath = argv[++i];
+        }
+        else if (option == "--backlog" && i + 1 < argc)
+        {
+            m_backlog = ParseCount(option, argv[++i]);
+        }
+        else if (option == "--menu" && i + 1 < argc)
+        {
+            m_menuPath = argv[++i];
+        }
+        else
+        {
+            throw InvalidArgument("Unknown option: " + option);
+        }
+    }
+
+    m_poolMax = std::max(m_poolMin, m_poolMax);
+
     m_initialized = true;
 }
 
+///////////////////////////////////////////////////////////////////////////////
+size_t Core::ParseCount(const std::string& option, const std::string& value)
+{
+    size_t pos = 0;
+    long long count = -1;
+
+    try
+    {
+        count = std::stoll(value, &pos);
+    }
+    catch (const std::exception&)
+    {
+        pos = 0;
+    }
+
+    if (pos != value.length() || count < 0)
+    {
+        throw InvalidArgument("Invalid " + option + " value: " + value);
+    }
+
+    return (static_cast<size_t>(count));
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 bool Core::IsInitialized(void) const
 {
@@ -101,10 +273,24 @@ bool Core::IsInitialized(void) const
 ///////////////////////////////////////////////////////////////////////////////
 void Core::OpenPizzeria(void)
 {
-    if (m_initialized)
+    if (!m_initialized)
+    {
+        return;
+    }
+
+    if (m_ordersPath.empty())
     {
         m_cli->Run();
+        return;
+    }
+
+    // Enough pizzas in flight to keep eight kitchens full by default
+    size_t backlog = m_backlog;
+    if (backlog == 0)
+    {
+        backlog = 8 * 2 * static_cast<size_t>(m_cooksPerKitchen);
     }
+    m_cli->RunBatch(m_ordersPath, backlog);
 }
 
 } // !namespace Plazza
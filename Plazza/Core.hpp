@@ -8,8 +8,10 @@
 ///////////////////////////////////////////////////////////////////////////////
 #include "Reception/Reception.hpp"
 #include "Reception/CLI.hpp"
+#include "Utils/MetricsServer.hpp"
 #include <string>
 #include <memory>
+#include <optional>
 
 ///////////////////////////////////////////////////////////////////////////////
 // Namespace Plazza
@@ -30,9 +32,23 @@ private:
     double m_cookingTimeMultiplier;             //<!
     int m_cooksPerKitchen;                      //<!
     long long m_restockTimeMs;                  //<!
+    Reception::DispatchPolicy m_dispatchPolicy; //<!
+    size_t m_poolMin;                           //<!
+    size_t m_poolMax;                           //<!
+    KitchenHandle::IdlePolicy m_idlePolicy;     //<!
+    bool m_respawn;                             //<!
+    std::string m_traceDirectory;               //<! Empty if not tracing
+    std::string m_logDirectory;                 //<! Empty for text logs
+    std::optional<uint16_t> m_metricsPort;      //<!
+    std::string m_metricsSocket;                //<! Empty if not set
+    std::string m_ordersPath;                   //<! Empty for the prompt
+    std::string m_menuPath;                     //<! Empty for the built-in
+    size_t m_backlog;                           //<! 0 for the default
     bool m_initialized;                         //<!
+    std::unique_ptr<Zygote> m_zygote;           //<! Outlives m_reception
     std::unique_ptr<Reception> m_reception;     //<!
     std::unique_ptr<CLI> m_cli;                 //<!
+    std::unique_ptr<MetricsServer> m_metrics;   //<!
 
 public:
     ///////////////////////////////////////////////////////////////////////////
@@ -70,6 +86,17 @@ private:
     ///////////////////////////////////////////////////////////////////////////
     void ParseArguments(int argc, char* argv[]);
 
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param option
+    /// \param value
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static size_t ParseCount(const std::string& option, const std::string& value);
+
 public:
     ///////////////////////////////////////////////////////////////////////////
     /// \brief
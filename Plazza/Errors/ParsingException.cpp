@@ -12,6 +12,21 @@ namespace Plazza
 ///////////////////////////////////////////////////////////////////////////////
 ParsingException::ParsingException(const std::string& message)
     : Exception("Parsing Error: " + message)
+    , m_column(0)
 {}
 
+///////////////////////////////////////////////////////////////////////////////
+ParsingException::ParsingException(const std::string& message, size_t column)
+    : Exception(
+        "Parsing Error: column " + std::to_string(column) + ": " + message
+    )
+    , m_column(column)
+{}
+
+///////////////////////////////////////////////////////////////////////////////
+size_t ParsingException::GetColumn(void) const
+{
+    return (m_column);
+}
+
 } // namespace Plazza
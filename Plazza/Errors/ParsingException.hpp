@@ -20,6 +20,12 @@ namespace Plazza
 ///////////////////////////////////////////////////////////////////////////////
 class ParsingException : public Exception
 {
+private:
+    ///////////////////////////////////////////////////////////////////////////
+    //
+    ///////////////////////////////////////////////////////////////////////////
+    size_t m_column;    //<! 1-based, 0 if unknown
+
 public: 
     ///////////////////////////////////////////////////////////////////////////
     /// \brief
@@ -28,6 +34,24 @@ public:
     ///
     ///////////////////////////////////////////////////////////////////////////
     ParsingException(const std::string& message);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param message
+    /// \param column 1-based position of the offending character
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    ParsingException(const std::string& message, size_t column);
+
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    size_t GetColumn(void) const;
 };
 
 } // namespace Plazza
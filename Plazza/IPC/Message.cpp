@@ -80,7 +80,8 @@ std::optional<Message> Message::Unpack(const std::vector<char>& buffer)
         Message::Order data;
         if (
             ReadFromBuffer(current, payload_actual_end, data.id) &&
-            ReadFromBuffer(current, payload_actual_end, data.pizza)
+            ReadFromBuffer(current, payload_actual_end, data.pizza) &&
+            ReadFromBuffer(current, payload_actual_end, data.sequence)
         )
         {
             result = Message(data);
@@ -92,6 +93,7 @@ std::optional<Message> Message::Unpack(const std::vector<char>& buffer)
         if (
             ReadFromBuffer(current, payload_actual_end, data.id) &&
             ReadFromBuffer(current, payload_actual_end, data.stock) &&
+            ReadFromBuffer(current, payload_actual_end, data.committed) &&
             ReadFromBuffer(current, payload_actual_end, data.timestamp) &&
             ReadFromBuffer(current, payload_actual_end, data.idleCount) &&
             ReadFromBuffer(current, payload_actual_end, data.pizzaCount) &&
@@ -110,7 +112,100 @@ std::optional<Message> Message::Unpack(const std::vector<char>& buffer)
         Message::CookedPizza data;
         if (
             ReadFromBuffer(current, payload_actual_end, data.id) &&
-            ReadFromBuffer(current, payload_actual_end, data.pizza)
+            ReadFromBuffer(current, payload_actual_end, data.pizza) &&
+            ReadFromBuffer(current, payload_actual_end, data.sequence) &&
+            ReadFromBuffer(current, payload_actual_end, data.startedAt) &&
+            ReadFromBuffer(current, payload_actual_end, data.doneAt)
+        )
+        {
+            result = Message(data);
+        }
+    }
+    else if (type_idx == 5)
+    {
+        Message::Steal data;
+        if (
+            ReadFromBuffer(current, payload_actual_end, data.id) &&
+            ReadFromBuffer(current, payload_actual_end, data.count) &&
+            ReadFromBuffer(current, payload_actual_end, data.thief)
+        )
+        {
+            result = Message(data);
+        }
+    }
+    else if (type_idx == 6)
+    {
+        Message::Stolen data;
+        if (
+            ReadFromBuffer(current, payload_actual_end, data.id) &&
+            ReadFromBuffer(current, payload_actual_end, data.pizza) &&
+            ReadFromBuffer(current, payload_actual_end, data.sequence) &&
+            ReadFromBuffer(current, payload_actual_end, data.thief)
+        )
+        {
+            result = Message(data);
+        }
+    }
+    else if (type_idx == 7)
+    {
+        Message::Activate data;
+        if (ReadFromBuffer(current, payload_actual_end, data.id))
+        {
+            result = Message(data);
+        }
+    }
+    else if (type_idx == 8)
+    {
+        Message::Spawn data;
+        if (
+            ReadFromBuffer(current, payload_actual_end, data.id) &&
+            ReadFromBuffer(current, payload_actual_end, data.cookCount) &&
+            ReadFromBuffer(current, payload_actual_end, data.multiplier) &&
+            ReadFromBuffer(current, payload_actual_end, data.restockTime) &&
+            ReadFromBuffer(current, payload_actual_end, data.active) &&
+            ReadFromBuffer(current, payload_actual_end, data.idleTimeout) &&
+            ReadFromBuffer(current, payload_actual_end, data.hibernationTtl)
+        )
+        {
+            result = Message(data);
+        }
+    }
+    else if (type_idx == 9)
+    {
+        Message::Spawned data;
+        if (
+            ReadFromBuffer(current, payload_actual_end, data.id) &&
+            ReadFromBuffer(current, payload_actual_end, data.pid)
+        )
+        {
+            result = Message(data);
+        }
+    }
+    else if (type_idx == 10)
+    {
+        Message::Hibernated data;
+        if (ReadFromBuffer(current, payload_actual_end, data.id))
+        {
+            result = Message(data);
+        }
+    }
+    else if (type_idx == 11)
+    {
+        Message::Died data;
+        if (
+            ReadFromBuffer(current, payload_actual_end, data.id) &&
+            ReadFromBuffer(current, payload_actual_end, data.crashed)
+        )
+        {
+            result = Message(data);
+        }
+    }
+    else if (type_idx == 12)
+    {
+        Message::Cancel data;
+        if (
+            ReadFromBuffer(current, payload_actual_end, data.id) &&
+            ReadFromBuffer(current, payload_actual_end, data.order)
         )
         {
             result = Message(data);
@@ -147,11 +242,13 @@ std::vector<char> Message::Pack(void) const
         {
             AppendToBuffer(payload_buffer, data.id);
             AppendToBuffer(payload_buffer, data.pizza);
+            AppendToBuffer(payload_buffer, data.sequence);
         }
         else if constexpr (std::is_same_v<T, Message::Status>)
         {
             AppendToBuffer(payload_buffer, data.id);
             AppendToBuffer(payload_buffer, data.stock);
+            AppendToBuffer(payload_buffer, data.committed);
             AppendToBuffer(payload_buffer, data.timestamp);
             AppendToBuffer(payload_buffer, data.idleCount);
             AppendToBuffer(payload_buffer, data.pizzaCount);
@@ -164,6 +261,55 @@ std::vector<char> Message::Pack(void) const
         {
             AppendToBuffer(payload_buffer, data.id);
             AppendToBuffer(payload_buffer, data.pizza);
+            AppendToBuffer(payload_buffer, data.sequence);
+            AppendToBuffer(payload_buffer, data.startedAt);
+            AppendToBuffer(payload_buffer, data.doneAt);
+        }
+        else if constexpr (std::is_same_v<T, Message::Steal>)
+        {
+            AppendToBuffer(payload_buffer, data.id);
+            AppendToBuffer(payload_buffer, data.count);
+            AppendToBuffer(payload_buffer, data.thief);
+        }
+        else if constexpr (std::is_same_v<T, Message::Stolen>)
+        {
+            AppendToBuffer(payload_buffer, data.id);
+            AppendToBuffer(payload_buffer, data.pizza);
+            AppendToBuffer(payload_buffer, data.sequence);
+            AppendToBuffer(payload_buffer, data.thief);
+        }
+        else if constexpr (std::is_same_v<T, Message::Activate>)
+        {
+            AppendToBuffer(payload_buffer, data.id);
+        }
+        else if constexpr (std::is_same_v<T, Message::Spawn>)
+        {
+            AppendToBuffer(payload_buffer, data.id);
+            AppendToBuffer(payload_buffer, data.cookCount);
+            AppendToBuffer(payload_buffer, data.multiplier);
+            AppendToBuffer(payload_buffer, data.restockTime);
+            AppendToBuffer(payload_buffer, data.active);
+            AppendToBuffer(payload_buffer, data.idleTimeout);
+            AppendToBuffer(payload_buffer, data.hibernationTtl);
+        }
+        else if constexpr (std::is_same_v<T, Message::Spawned>)
+        {
+            AppendToBuffer(payload_buffer, data.id);
+            AppendToBuffer(payload_buffer, data.pid);
+        }
+        else if constexpr (std::is_same_v<T, Message::Hibernated>)
+        {
+            AppendToBuffer(payload_buffer, data.id);
+        }
+        else if constexpr (std::is_same_v<T, Message::Died>)
+        {
+            AppendToBuffer(payload_buffer, data.id);
+            AppendToBuffer(payload_buffer, data.crashed);
+        }
+        else if constexpr (std::is_same_v<T, Message::Cancel>)
+        {
+            AppendToBuffer(payload_buffer, data.id);
+            AppendToBuffer(payload_buffer, data.order);
         }
     }, m_data);
 
@@ -6,6 +6,7 @@
 ///////////////////////////////////////////////////////////////////////////////
 // Dependencies
 ///////////////////////////////////////////////////////////////////////////////
+#include "Pizza/PackedPizza.hpp"
 #include <string>
 #include <vector>
 #include <cstdint>
@@ -43,7 +44,8 @@ public:
     struct Order
     {
         size_t id;
-        uint16_t pizza;
+        PackedPizza pizza;  //<! With the customer order it belongs to
+        uint32_t sequence;  //<! Position of the pizza within that order
     };
 
     ///////////////////////////////////////////////////////////////////////////
@@ -54,6 +56,7 @@ public:
     {
         size_t id;
         std::string stock;
+        std::string committed;
         int64_t timestamp;
         size_t idleCount;
         size_t pizzaCount;
@@ -74,7 +77,96 @@ public:
     struct CookedPizza
     {
         size_t id;
-        uint16_t pizza;
+        PackedPizza pizza;
+        uint32_t sequence;
+        int64_t startedAt;  //<! Steady clock, in nanoseconds
+        int64_t doneAt;     //<! Steady clock, in nanoseconds
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Ask a kitchen to give back up to count unstarted pizzas
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    struct Steal
+    {
+        size_t id;
+        size_t count;
+        size_t thief;       //<! Idle kitchen the pizzas are meant for
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief A pizza taken back from a kitchen queue, to be dispatched again
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    struct Stolen
+    {
+        size_t id;
+        PackedPizza pizza;
+        uint32_t sequence;
+        size_t thief;       //<! As in the Steal
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Put a pre-forked kitchen from the pool into service
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    struct Activate
+    {
+        size_t id;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Ask the zygote to fork a new kitchen
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    struct Spawn
+    {
+        size_t id;
+        size_t cookCount;
+        double multiplier;
+        int64_t restockTime;
+        bool active;
+        int64_t idleTimeout;
+        int64_t hibernationTtl;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief The zygote's answer to Spawn, pid is -1 if the fork failed
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    struct Spawned
+    {
+        size_t id;
+        int32_t pid;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief An idle kitchen parked itself and can be reused with Activate
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    struct Hibernated
+    {
+        size_t id;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Sent by the zygote once it reaped a kitchen process
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    struct Died
+    {
+        size_t id;
+        bool crashed;   //<! Killed by a signal or non-zero exit code
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Drop every queued pizza of an order the Reception gave up on
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    struct Cancel
+    {
+        size_t id;
+        uint32_t order;
     };
 
 private:
@@ -86,7 +178,15 @@ private:
         Order,
         Status,
         RequestStatus,
-        CookedPizza
+        CookedPizza,
+        Steal,
+        Stolen,
+        Activate,
+        Spawn,
+        Spawned,
+        Hibernated,
+        Died,
+        Cancel
     > m_data;
 
 private:
@@ -152,7 +252,7 @@ private:
     )
     {
         static_assert(
-            std::is_trivial_v<T> && std::is_standard_layout_v<T>,
+            std::is_trivially_copyable_v<T> && std::is_standard_layout_v<T>,
             "Type must be POD-like for direct memory copy."
         );
         const char* bytes = reinterpret_cast<const char*>(&value);
@@ -185,7 +285,7 @@ private:
     static bool ReadFromBuffer(const char*& current, const char* end, T& value)
     {
         static_assert(
-            std::is_trivial_v<T> && std::is_standard_layout_v<T>,
+            std::is_trivially_copyable_v<T> && std::is_standard_layout_v<T>,
             "Type must be POD-like for direct memory copy."
         );
         if (current + sizeof(T) > end)
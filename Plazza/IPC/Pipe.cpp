@@ -2,7 +2,10 @@
 // Dependencies
 ///////////////////////////////////////////////////////////////////////////////
 #include "IPC/Pipe.hpp"
+#include "Utils/Tracer.hpp"
+#include "Utils/Metrics.hpp"
 #include <fcntl.h>
+#include <poll.h>
 #include <sys/stat.h>
 #include <unistd.h>
 #include <system_error>
@@ -21,6 +24,7 @@ Pipe::Pipe(const std::string& name, Pipe::OpenMode mode)
     : m_name(name)
     , m_mode(mode)
     , m_fd(-1)
+    , m_hungUp(false)
 {}
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -29,6 +33,7 @@ Pipe::Pipe(Pipe&& other) noexcept
     , m_mode(other.m_mode)
     , m_fd(other.m_fd)
     , m_buffer(std::move(other.m_buffer))
+    , m_hungUp(other.m_hungUp)
 {
     other.m_fd = -1;
 }
@@ -50,6 +55,7 @@ Pipe& Pipe::operator=(Pipe&& other) noexcept
         m_mode = other.m_mode;
         m_fd = other.m_fd;
         m_buffer = std::move(other.m_buffer);
+        m_hungUp = other.m_hungUp;
 
         other.m_fd = -1;
     }
@@ -127,6 +133,20 @@ void Pipe::SendMessage(const Message& message)
         return;
     }
 
+    static Metrics::Counter& sentMessages = Metrics::GetInstance().GetCounter(
+        "plazza_ipc_messages_total", "Messages through the named pipes",
+        {{"direction", "sent"}}
+    );
+    static Metrics::Counter& sentBytes = Metrics::GetInstance().GetCounter(
+        "plazza_ipc_bytes_total", "Bytes through the named pipes",
+        {{"direction", "sent"}}
+    );
+    Tracer::Scope trace(
+        Tracer::Event::IPC_SEND,
+        static_cast<uint8_t>(packed_message[sizeof(uint32_t)]),
+        packed_message.size()
+    );
+
     ssize_t total_written = 0;
     size_t total_to_write = packed_message.size();
     const char* data_ptr = packed_message.data();
@@ -150,6 +170,8 @@ void Pipe::SendMessage(const Message& message)
         }
         total_written += bytes_written;
     }
+    sentMessages.Increment();
+    sentBytes.Increment(total_to_write);
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -160,9 +182,12 @@ std::optional<Message> Pipe::PollMessage(void)
         return (std::nullopt);
     }
 
+    TimePoint begin = Tracer::IsEnabled() ? SteadyClock::Now() : TimePoint();
     char read_buf[4096];
     ssize_t bytes_read = read(m_fd, read_buf, sizeof(read_buf));
 
+    m_hungUp = (bytes_read == 0);
+
     if (bytes_read > 0)
     {
         m_buffer.insert(m_buffer.end(), read_buf, read_buf + bytes_read);
@@ -226,8 +251,58 @@ std::optional<Message> Pipe::PollMessage(void)
         // Data has been consumed from buffer. Log or handle as error.
         // std::cerr << "Warning: Message::Unpack failed. Discarded malformed message segment." << std::endl;
     }
+    else
+    {
+        static Metrics::Counter& messages = Metrics::GetInstance().GetCounter(
+            "plazza_ipc_messages_total", "Messages through the named pipes",
+            {{"direction", "received"}}
+        );
+        static Metrics::Counter& bytes = Metrics::GetInstance().GetCounter(
+            "plazza_ipc_bytes_total", "Bytes through the named pipes",
+            {{"direction", "received"}}
+        );
+
+        messages.Increment();
+        bytes.Increment(required_total_len);
+        Tracer::Trace(
+            Tracer::Event::IPC_RECEIVE, begin, SteadyClock::Now(),
+            static_cast<uint8_t>(current_message_bytes[sizeof(uint32_t)]),
+            required_total_len
+        );
+    }
     
     return (unpacked_msg);
 }
 
+///////////////////////////////////////////////////////////////////////////////
+bool Pipe::Wait(Milliseconds timeout)
+{
+    if (m_mode != OpenMode::READ_ONLY || m_fd == -1)
+    {
+        return (false);
+    }
+
+    if (m_buffer.size() >= sizeof(uint32_t))
+    {
+        return (true);
+    }
+
+    struct pollfd pfd = {m_fd, POLLIN, 0};
+
+    // POLLHUP counts as readable: the next PollMessage sees the EOF.
+    return (poll(&pfd, 1, static_cast<int>(timeout.count())) > 0);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+bool Pipe::IsHungUp(void) const
+{
+    return (m_hungUp);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int Pipe::GetFileDescriptor(void) const
+{
+    return (m_fd);
+}
+
 } // !namespace Plazza
@@ -8,6 +8,7 @@
 ///////////////////////////////////////////////////////////////////////////////
 #include "IPC/IIPCChannel.hpp"
 #include "IPC/Message.hpp"
+#include "Utils/Timer.hpp"
 #include <optional>
 #include <vector>
 #include <string>
@@ -23,6 +24,8 @@ namespace Plazza
 ///////////////////////////////////////////////////////////////////////////////
 #define KITCHEN_TO_RECEPTION_PIPE "/tmp/plazza_kitchen_to_reception_pipe"
 #define RECEPTION_TO_KITCHEN_PIPE "/tmp/plazza_reception_to_kitchen_pipe"
+#define RECEPTION_TO_ZYGOTE_PIPE "/tmp/plazza_reception_to_zygote_pipe"
+#define ZYGOTE_TO_RECEPTION_PIPE "/tmp/plazza_zygote_to_reception_pipe"
 
 ///////////////////////////////////////////////////////////////////////////////
 /// \brief
@@ -49,6 +52,7 @@ private:
     OpenMode m_mode;            //<!
     int m_fd;                   //<!
     std::vector<char> m_buffer; //<!
+    bool m_hungUp;              //<! Last read hit EOF
 
 public:
     ///////////////////////////////////////////////////////////////////////////
@@ -125,6 +129,32 @@ public:
     ///
     ///////////////////////////////////////////////////////////////////////////
     virtual std::optional<Message> PollMessage(void) override;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Block until a READ_ONLY pipe has something to read
+    ///
+    /// \param timeout
+    ///
+    /// \return True if PollMessage may now return a message
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    bool Wait(Milliseconds timeout);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \return True once every writer of a READ_ONLY pipe has gone away
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    bool IsHungUp(void) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \return The underlying descriptor, for poll(2), or -1 if closed
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    int GetFileDescriptor(void) const;
 };
 
 } // !namespace Plazza
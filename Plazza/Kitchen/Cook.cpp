@@ -2,8 +2,9 @@
 /// Dependencies
 ///////////////////////////////////////////////////////////////////////////////
 #include "Kitchen/Cook.hpp"
-#include "Kitchen/Kitchen.hpp"
+#include "Kitchen/KitchenRuntime.hpp"
 #include "Kitchen/Stock.hpp"
+#include "Utils/Tracer.hpp"
 #include <iostream>
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -13,7 +14,7 @@ namespace Plazza
 {
 
 ///////////////////////////////////////////////////////////////////////////////
-Cook::Cook(Kitchen& kitchen, Stock& stock)
+Cook::Cook(KitchenRuntime& kitchen, Stock& stock)
     : Thread(std::bind(&Cook::Routine, this))
     , m_kitchen(kitchen)
     , m_stock(stock)
@@ -43,22 +44,29 @@ void Cook::Routine(void)
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-bool Cook::CookPizza(uint16_t packedPizza)
+bool Cook::CookPizza(const Message::Order& order)
 {
     if (!running)
     {
         return (false);
     }
 
-    if (auto pizza = IPizza::Unpack(packedPizza))
+    if (const Recipe* recipe = RecipeBook::Unpack(order.pizza))
     {
-        auto ingredients = pizza.value()->GetIngredients();
-
-        if (!m_stock.WaitAndReserveIngredients(ingredients, Seconds(2)))
+        TimePoint waitedAt = SteadyClock::Now();
+        bool reserved = m_stock.WaitAndReserveIngredients(
+            recipe->needs, Seconds(2)
+        );
+
+        Tracer::Trace(
+            Tracer::Event::INGREDIENT_WAIT, waitedAt, SteadyClock::Now(),
+            order.pizza.GetOrder(), order.sequence
+        );
+        if (!reserved)
         {
             if (running)
             {
-                m_kitchen.AddPizzaToQueue(packedPizza);
+                m_kitchen.AddPizzaToQueue(order, true);
             }
             return (false);
         }
@@ -70,13 +78,18 @@ bool Cook::CookPizza(uint16_t packedPizza)
 
         m_kitchen.SendStatus();
 
+        TimePoint startedAt = SteadyClock::Now();
         m_cooking = true;
-        std::this_thread::sleep_for(pizza.value()->GetCookingTime());
+        std::this_thread::sleep_for(recipe->GetCookingTime());
         m_cooking = false;
+        Tracer::Trace(
+            Tracer::Event::COOK, startedAt, SteadyClock::Now(),
+            order.pizza.GetOrder(), order.sequence
+        );
 
         if (running)
         {
-            m_kitchen.NotifyPizzaCompletion(*pizza.value());
+            m_kitchen.NotifyPizzaCompletion(order, *recipe, startedAt);
         }
 
         return (true);
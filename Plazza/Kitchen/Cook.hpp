@@ -8,7 +8,8 @@
 ///////////////////////////////////////////////////////////////////////////////
 #include "Kitchen/Stock.hpp"
 #include "Concurrency/Thread.hpp"
-#include "Pizza/IPizza.hpp"
+#include "Pizza/Recipe.hpp"
+#include "IPC/Message.hpp"
 #include <atomic>
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -20,7 +21,7 @@ namespace Plazza
 ///////////////////////////////////////////////////////////////////////////////
 //
 ///////////////////////////////////////////////////////////////////////////////
-class Kitchen;
+class KitchenRuntime;
 class Stock;
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -33,7 +34,7 @@ private:
     ///////////////////////////////////////////////////////////////////////////
     //
     ///////////////////////////////////////////////////////////////////////////
-    Kitchen& m_kitchen;             //<! The kitchen the cook belongs to
+    KitchenRuntime& m_kitchen;      //<! The kitchen the cook belongs to
     Stock& m_stock;                 //<! The stock the cook uses
     std::atomic<bool> m_cooking;    //<! Flag to indicate if the cook is cooking
 
@@ -42,7 +43,7 @@ public:
     /// \brief
     ///
     ///////////////////////////////////////////////////////////////////////////
-    Cook(Kitchen& kitchen, Stock& stock);
+    Cook(KitchenRuntime& kitchen, Stock& stock);
 
 private:
     ///////////////////////////////////////////////////////////////////////////
@@ -54,8 +55,10 @@ private:
     ///////////////////////////////////////////////////////////////////////////
     /// \brief
     ///
+    /// \param order
+    ///
     ///////////////////////////////////////////////////////////////////////////
-    bool CookPizza(uint16_t pizza);
+    bool CookPizza(const Message::Order& order);
 
 public:
     ///////////////////////////////////////////////////////////////////////////
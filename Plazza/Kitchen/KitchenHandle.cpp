@@ -0,0 +1,114 @@
+///////////////////////////////////////////////////////////////////////////////
+/// Dependencies
+///////////////////////////////////////////////////////////////////////////////
+#include "Kitchen/KitchenHandle.hpp"
+#include "Kitchen/KitchenRuntime.hpp"
+#include "Kitchen/Stock.hpp"
+#include "Kitchen/Zygote.hpp"
+#include <system_error>
+
+///////////////////////////////////////////////////////////////////////////////
+/// Namespace Plazza
+///////////////////////////////////////////////////////////////////////////////
+namespace Plazza
+{
+
+///////////////////////////////////////////////////////////////////////////////
+size_t KitchenHandle::s_nextId = 0;
+
+///////////////////////////////////////////////////////////////////////////////
+KitchenHandle::KitchenHandle(
+    size_t numberOfCooks,
+    double multiplier,
+    Milliseconds restockTime,
+    bool active,
+    IdlePolicy idle,
+    Zygote* zygote
+)
+    : KitchenHandle(
+        Message::Spawn{
+            s_nextId++, numberOfCooks, multiplier, restockTime.count(),
+            active, idle.idleTimeout.count(), idle.hibernationTtl.count()
+        },
+        zygote
+    )
+{}
+
+///////////////////////////////////////////////////////////////////////////////
+KitchenHandle::KitchenHandle(const Message::Spawn& spawn, Zygote* zygote)
+    : Process([spawn]()
+    {
+        KitchenRuntime::Run(spawn);
+    })
+    , m_id(spawn.id)
+    , m_spawnedPid(-1)
+    , status{
+        m_id, "5 5 5 5 5 5 5 5 5", Stock::Pack(Stock::Quantities{}),
+        0, spawn.cookCount, 0, 0
+    }
+{
+    if (zygote)
+    {
+        m_spawnedPid = zygote->Spawn(spawn);
+    }
+    else
+    {
+        Start();
+    }
+    pipe = std::make_unique<Pipe>(
+        std::string(RECEPTION_TO_KITCHEN_PIPE) + "_" + std::to_string(m_id),
+        Pipe::OpenMode::WRITE_ONLY
+    );
+    pipe->Open();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+KitchenHandle::~KitchenHandle()
+{
+    if (IsRunning())
+    {
+        Wait();
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+size_t KitchenHandle::GetID(void) const
+{
+    return (m_id);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+pid_t KitchenHandle::GetKitchenPid(void) const
+{
+    return (m_spawnedPid != -1 ? m_spawnedPid : GetPid());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+bool KitchenHandle::HasDied(bool& crashed)
+{
+    if (m_spawnedPid != -1 || IsRunning())
+    {
+        return (false);
+    }
+    crashed = GetStatus() != IProcess::Status::FINISHED ||
+        GetReturnValue() != 0;
+    return (true);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+bool KitchenHandle::Send(const Message& message)
+{
+    try
+    {
+        pipe->SendMessage(message);
+    }
+    catch (const std::system_error&)
+    {
+        // The kitchen died; its Died message, or HasDied without a zygote,
+        // will clean it up.
+        return (false);
+    }
+    return (true);
+}
+
+} // !namespace Plazza
@@ -0,0 +1,142 @@
+///////////////////////////////////////////////////////////////////////////////
+// Header guard
+///////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+///////////////////////////////////////////////////////////////////////////////
+// Dependencies
+///////////////////////////////////////////////////////////////////////////////
+#include "Concurrency/Process.hpp"
+#include "Utils/Timer.hpp"
+#include "IPC/Message.hpp"
+#include "IPC/Pipe.hpp"
+#include <memory>
+
+///////////////////////////////////////////////////////////////////////////////
+// Namespace Plazza
+///////////////////////////////////////////////////////////////////////////////
+namespace Plazza
+{
+
+///////////////////////////////////////////////////////////////////////////////
+//
+///////////////////////////////////////////////////////////////////////////////
+class Zygote;
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Reception side of a kitchen: its id, channel, status and pid
+///
+/// The cooks, stock and queue only exist in the child, in a KitchenRuntime.
+///
+///////////////////////////////////////////////////////////////////////////////
+class KitchenHandle : public Process
+{
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief What a kitchen does once all its cooks sat idle long enough
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    struct IdlePolicy
+    {
+        Milliseconds idleTimeout;       //<! Idle time before closing or hibernating
+        Milliseconds hibernationTtl;    //<! Time parked before teardown, 0 to close at once
+    };
+
+private:
+    ///////////////////////////////////////////////////////////////////////////
+    //
+    ///////////////////////////////////////////////////////////////////////////
+    static size_t s_nextId;
+
+private:
+    ///////////////////////////////////////////////////////////////////////////
+    //
+    ///////////////////////////////////////////////////////////////////////////
+    size_t m_id;                                        //<!
+    pid_t m_spawnedPid;                                 //<! Set when forked by a Zygote
+
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    //
+    ///////////////////////////////////////////////////////////////////////////
+    std::unique_ptr<Pipe> pipe;                         //<!
+    Message::Status status;                             //<!
+
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Fork a kitchen and connect to it
+    ///
+    /// \param numberOfCooks
+    /// \param multiplier
+    /// \param restockTime
+    /// \param active False to start parked in the pool, waiting for Activate
+    /// \param idle
+    /// \param zygote Fork the kitchen process through it instead of directly
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    KitchenHandle(
+        size_t numberOfCooks = 1,
+        double multiplier = 1.0,
+        Milliseconds restockTime = Milliseconds(1000),
+        bool active = true,
+        IdlePolicy idle = {Milliseconds(5000), Milliseconds(0)},
+        Zygote* zygote = nullptr
+    );
+
+private:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param spawn
+    /// \param zygote
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    KitchenHandle(const Message::Spawn& spawn, Zygote* zygote);
+
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    ~KitchenHandle();
+
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    size_t GetID(void) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \return The kitchen's pid, wherever it was forked from
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    pid_t GetKitchenPid(void) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Reap a kitchen forked directly, for which no Died message comes
+    ///
+    /// \param crashed Set if it was killed by a signal or exited non-zero
+    ///
+    /// \return True once its process is gone, always false if a Zygote
+    /// forked it
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    bool HasDied(bool& crashed);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Send a message to the kitchen
+    ///
+    /// \param message
+    ///
+    /// \return False if the kitchen is gone (EPIPE)
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    bool Send(const Message& message);
+};
+
+} // !namespace Plazza
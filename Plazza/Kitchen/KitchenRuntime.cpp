@@ -0,0 +1,385 @@
+///////////////////////////////////////////////////////////////////////////////
+/// Dependencies
+///////////////////////////////////////////////////////////////////////////////
+#include "Kitchen/KitchenRuntime.hpp"
+#include "IPC/Message.hpp"
+#include "IPC/Pipe.hpp"
+#include "Pizza/Recipe.hpp"
+#include "Utils/Tracer.hpp"
+#include <iostream>
+
+///////////////////////////////////////////////////////////////////////////////
+/// Namespace Plazza
+///////////////////////////////////////////////////////////////////////////////
+namespace Plazza
+{
+
+///////////////////////////////////////////////////////////////////////////////
+KitchenRuntime::KitchenRuntime(const Message::Spawn& spawn)
+    : m_restockTime(Milliseconds(spawn.restockTime))
+    , m_multiplier(spawn.multiplier)
+    , m_cookCount(spawn.cookCount)
+    , m_id(spawn.id)
+    , m_forclosureTime(SteadyClock::Now())
+    , m_isRoutineRunning(true)
+    , m_active(spawn.active)
+    , m_committed{}
+    , m_elapsedMs(0)
+    , m_pizzaTime(0)
+    , m_idle{
+        Milliseconds(spawn.idleTimeout), Milliseconds(spawn.hibernationTtl)
+    }
+{}
+
+///////////////////////////////////////////////////////////////////////////////
+void KitchenRuntime::Run(const Message::Spawn& spawn)
+{
+    // The process exits as soon as the routine returns, so the runtime is
+    // never torn down: its cooks and stock thread die with the process.
+    Tracer::SetRole(Tracer::Role::KITCHEN, spawn.id);
+
+    KitchenRuntime* kitchen = new KitchenRuntime(spawn);
+    kitchen->Routine();
+    Tracer::Flush();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void KitchenRuntime::RoutineInitialization(void)
+{
+    m_stock = std::make_unique<Stock>(m_restockTime, *this);
+    m_stock->SetParked(!m_active);
+    m_fromReception = std::make_unique<Pipe>(
+        std::string(RECEPTION_TO_KITCHEN_PIPE) + "_" + std::to_string(m_id),
+        Pipe::OpenMode::READ_ONLY
+    );
+    m_toReception = std::make_unique<Pipe>(
+        std::string(KITCHEN_TO_RECEPTION_PIPE),
+        Pipe::OpenMode::WRITE_ONLY
+    );
+
+    m_fromReception->Open();
+    m_toReception->Open();
+
+    for (size_t i = 0; i < m_cookCount; i++)
+    {
+        m_cooks.push_back(std::make_unique<Cook>(*this, *m_stock));
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void KitchenRuntime::Routine(void)
+{
+    RoutineInitialization();
+
+    while (m_isRoutineRunning)
+    {
+        while (const auto& message = m_fromReception->PollMessage())
+        {
+            if (message->Is<Message::RequestStatus>())
+            {
+                SendStatus();
+            }
+            else if (const auto& order = message->GetIf<Message::Order>())
+            {
+                // An order crossing our Hibernated message wakes us up.
+                if (!m_active)
+                {
+                    SetActive(true);
+                }
+                AddPizzaToQueue(*order);
+            }
+            else if (const auto& steal = message->GetIf<Message::Steal>())
+            {
+                StealPizzas(steal->count, steal->thief);
+            }
+            else if (const auto& cancel = message->GetIf<Message::Cancel>())
+            {
+                CancelOrder(cancel->order);
+            }
+            else if (message->Is<Message::Activate>())
+            {
+                SetActive(true);
+                SendStatus();
+            }
+            else if (message->Is<Message::Closed>())
+            {
+                ForClosure();
+            }
+        }
+        ForClosureCheck();
+
+        // A parked kitchen sleeps until the Reception writes to it.
+        if (m_active || m_fromReception->IsHungUp())
+        {
+            std::this_thread::sleep_for(Milliseconds(10));
+        }
+        else
+        {
+            m_fromReception->Wait(Milliseconds(1000));
+        }
+    }
+
+    m_pizzaQueueCV.NotifyAll();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+size_t KitchenRuntime::GetID(void) const
+{
+    return (m_id);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void KitchenRuntime::SendStatus(void)
+{
+    std::unique_lock<std::mutex> lock(m_pizzaQueueMutex);
+    Tracer::Scope trace(Tracer::Event::STATUS_SEND, m_pizzaQueue.size());
+    std::string pack = m_stock->Pack();
+    Message status = Message::Status{
+        m_id,
+        pack,
+        Stock::Pack(m_committed),
+        m_elapsedMs,
+        static_cast<size_t>(m_idleCookCount),
+        m_pizzaQueue.size(),
+        m_pizzaTime
+    };
+
+    m_toReception->SendMessage(status);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void KitchenRuntime::NotifyPizzaCompletion(
+    const Message::Order& order,
+    const Recipe& recipe,
+    TimePoint startedAt
+)
+{
+    {
+        std::lock_guard<std::mutex> lock(m_pizzaQueueMutex);
+        m_pizzaTime -= recipe.GetCookingTime().count();
+    }
+    SendStatus();
+    m_toReception->SendMessage(Message::CookedPizza{
+        m_id, order.pizza, order.sequence,
+        SteadyClock::ToNs(startedAt), SteadyClock::ToNs(SteadyClock::Now())
+    });
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void KitchenRuntime::ForClosureCheck(void)
+{
+    if (!m_isRoutineRunning)
+    {
+        return;
+    }
+
+    m_idleCookCount = 0;
+
+    for (const auto& cooks : m_cooks)
+    {
+        if (!cooks->IsCooking())
+        {
+            m_idleCookCount++;
+        }
+    }
+
+    if (m_idleCookCount != static_cast<int>(m_cookCount) || !m_active)
+    {
+        m_forclosureTime = SteadyClock::Now();
+        m_elapsedMs = 0;
+    }
+    else
+    {
+        m_elapsedMs = SteadyClock::DurationToMs(
+            SteadyClock::Elapsed(m_forclosureTime, SteadyClock::Now())
+        );
+
+        if (m_elapsedMs < m_idle.idleTimeout.count())
+        {
+            return;
+        }
+
+        if (m_idle.hibernationTtl.count() > 0)
+        {
+            SetActive(false);
+            m_toReception->SendMessage(Message::Hibernated{m_id});
+        }
+        else
+        {
+            m_toReception->SendMessage(Message::Closed{m_id});
+        }
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void KitchenRuntime::SetActive(bool active)
+{
+    {
+        // Under the queue lock, or a cook between its check and its wait
+        // would miss the notify.
+        std::lock_guard<std::mutex> lock(m_pizzaQueueMutex);
+        m_active = active;
+    }
+    m_forclosureTime = SteadyClock::Now();
+    m_elapsedMs = 0;
+    m_stock->SetParked(!active);
+    m_pizzaQueueCV.NotifyAll();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void KitchenRuntime::ForClosure(void)
+{
+    m_isRoutineRunning = false;
+
+    for (auto& cook : m_cooks)
+    {
+        cook->running = false;
+    }
+
+    m_pizzaQueueCV.NotifyAll();
+
+    for (auto& cook : m_cooks)
+    {
+        if (cook->Joinable())
+        {
+            cook->Join();
+        }
+    }
+
+    m_cooks.clear();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+std::optional<Message::Order> KitchenRuntime::TryGetNextPizza(
+    Milliseconds timeout
+)
+{
+    std::unique_lock<std::mutex> lock(m_pizzaQueueMutex);
+
+    auto ready = [this]
+    {
+        return (!m_pizzaQueue.empty() || !m_isRoutineRunning);
+    };
+
+    // A parked kitchen's cooks sleep until there is work, not in a loop.
+    if (!m_active)
+    {
+        m_pizzaQueueCV.GetNativeHandle().wait(lock, [this, &ready]
+        {
+            return (ready() || m_active);
+        });
+    }
+
+    if (m_pizzaQueueCV.GetNativeHandle().wait_for(lock, timeout, ready))
+    {
+    if (!m_pizzaQueue.empty())
+    {
+        auto [order, queuedAt] = m_pizzaQueue.front();
+        m_pizzaQueue.pop_front();
+        Tracer::Trace(
+            Tracer::Event::QUEUE_WAIT, queuedAt, SteadyClock::Now(),
+            order.pizza.GetOrder(), order.sequence
+        );
+        if (const Recipe* recipe = RecipeBook::Unpack(order.pizza))
+        {
+            m_committed -= recipe->needs;
+        }
+        return (order);
+    }
+    }
+    return (std::nullopt);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void KitchenRuntime::AddPizzaToQueue(const Message::Order& order, bool requeue)
+{
+    const Recipe* recipe = RecipeBook::Unpack(order.pizza);
+
+    {
+        std::lock_guard<std::mutex> lock(m_pizzaQueueMutex);
+        m_pizzaQueue.push_back({order, SteadyClock::Now()});
+        if (recipe)
+        {
+            m_committed += recipe->needs;
+        }
+        // Counted from its first arrival until cooked or stolen
+        if (recipe && !requeue)
+        {
+            m_pizzaTime += recipe->GetCookingTime().count();
+        }
+    }
+
+    SendStatus();
+    m_pizzaQueueCV.NotifyOne();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void KitchenRuntime::StealPizzas(size_t count, size_t thief)
+{
+    std::vector<Message::Order> stolen;
+
+    {
+        std::lock_guard<std::mutex> lock(m_pizzaQueueMutex);
+
+        while (stolen.size() < count && !m_pizzaQueue.empty())
+        {
+            stolen.push_back(m_pizzaQueue.back().order);
+            m_pizzaQueue.pop_back();
+
+            const Recipe* recipe = RecipeBook::Unpack(stolen.back().pizza);
+            if (recipe)
+            {
+                m_committed -= recipe->needs;
+                m_pizzaTime -= recipe->GetCookingTime().count();
+            }
+        }
+    }
+
+    if (stolen.empty())
+    {
+        return;
+    }
+
+    SendStatus();
+    for (const auto& order : stolen)
+    {
+        m_toReception->SendMessage(Message::Stolen{
+            m_id, order.pizza, order.sequence, thief
+        });
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void KitchenRuntime::CancelOrder(uint32_t order)
+{
+    size_t dropped = 0;
+
+    {
+        std::lock_guard<std::mutex> lock(m_pizzaQueueMutex);
+
+        for (auto it = m_pizzaQueue.begin(); it != m_pizzaQueue.end();)
+        {
+            if (it->order.pizza.GetOrder() != order)
+            {
+                ++it;
+                continue;
+            }
+
+            const Recipe* recipe = RecipeBook::Unpack(it->order.pizza);
+            if (recipe)
+            {
+                m_committed -= recipe->needs;
+                m_pizzaTime -= recipe->GetCookingTime().count();
+            }
+            it = m_pizzaQueue.erase(it);
+            dropped++;
+        }
+    }
+
+    if (dropped > 0)
+    {
+        SendStatus();
+    }
+}
+
+} // !namespace Plazza
@@ -6,18 +6,18 @@
 ///////////////////////////////////////////////////////////////////////////////
 // Dependencies
 ///////////////////////////////////////////////////////////////////////////////
-#include "Concurrency/Process.hpp"
 #include "Concurrency/CondVar.hpp"
 #include "Concurrency/Mutex.hpp"
 #include "Kitchen/Cook.hpp"
+#include "Kitchen/KitchenHandle.hpp"
 #include "Kitchen/Stock.hpp"
 #include "Utils/Timer.hpp"
 #include "IPC/Pipe.hpp"
-#include "Pizza/IPizza.hpp"
+#include "Pizza/Recipe.hpp"
 #include <vector>
 #include <memory>
 #include <atomic>
-#include <queue>
+#include <deque>
 
 ///////////////////////////////////////////////////////////////////////////////
 // Namespace Plazza
@@ -31,16 +31,24 @@ namespace Plazza
 class Stock;
 
 ///////////////////////////////////////////////////////////////////////////////
-/// \brief
+/// \brief Child side of a kitchen: its cooks, stock and pizza queue
+///
+/// Only ever constructed inside the kitchen process. The Reception keeps a
+/// KitchenHandle instead.
 ///
 ///////////////////////////////////////////////////////////////////////////////
-class Kitchen : public Process
+class KitchenRuntime
 {
 private:
     ///////////////////////////////////////////////////////////////////////////
-    //
+    /// \brief A pizza waiting for a cook
+    ///
     ///////////////////////////////////////////////////////////////////////////
-    static size_t s_nextId;
+    struct QueuedPizza
+    {
+        Message::Order order;                   //<!
+        TimePoint queuedAt;                     //<!
+    };
 
 private:
     ///////////////////////////////////////////////////////////////////////////
@@ -58,48 +66,41 @@ private:
     std::vector<std::unique_ptr<Cook>> m_cooks;         //<!
     TimePoint m_forclosureTime;                         //<!
     bool m_isRoutineRunning;                            //<!
-    std::queue<uint16_t> m_pizzaQueue;                  //<!
+    std::atomic<bool> m_active;                         //<! False while pooled
+    std::deque<QueuedPizza> m_pizzaQueue;               //<!
+    Stock::Quantities m_committed;                      //<! Needs of m_pizzaQueue
     Mutex m_pizzaQueueMutex;                            //<!
     CondVar m_pizzaQueueCV;                             //<!
     int64_t m_elapsedMs;                                //<!
     int64_t m_pizzaTime;                                //<!
+    KitchenHandle::IdlePolicy m_idle;                   //<!
+    std::unique_ptr<Pipe> m_fromReception;              //<!
 
-public:
-    ///////////////////////////////////////////////////////////////////////////
-    //
-    ///////////////////////////////////////////////////////////////////////////
-    std::unique_ptr<Pipe> pipe;                         //<!
-    Message::Status status;                             //<!
-
-public:
+private:
     ///////////////////////////////////////////////////////////////////////////
     /// \brief
     ///
-    /// \param numberOfCooks
-    /// \param multiplier
-    /// \param restockTime
+    /// \param spawn Everything the Reception configured the kitchen with
     ///
     ///////////////////////////////////////////////////////////////////////////
-    Kitchen(
-        size_t numberOfCooks = 1,
-        double multiplier = 1.0,
-        Milliseconds restockTime = Milliseconds(1000)
-    );
+    explicit KitchenRuntime(const Message::Spawn& spawn);
 
+private:
     ///////////////////////////////////////////////////////////////////////////
     /// \brief
     ///
     ///////////////////////////////////////////////////////////////////////////
-    ~Kitchen();
+    void Routine(void);
 
-private:
+public:
     ///////////////////////////////////////////////////////////////////////////
-    /// \brief
+    /// \brief Build and run a kitchen in the freshly forked process
+    ///
+    /// \param spawn
     ///
     ///////////////////////////////////////////////////////////////////////////
-    void Routine(void);
+    static void Run(const Message::Spawn& spawn);
 
-public:
     ///////////////////////////////////////////////////////////////////////////
     /// \brief
     ///
@@ -132,14 +133,28 @@ public:
     ///////////////////////////////////////////////////////////////////////////
     void ForClosureCheck(void);
 
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Park or wake the cooks and the stock thread, keeping the process
+    ///
+    /// \param active
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void SetActive(bool active);
+
 
     ///////////////////////////////////////////////////////////////////////////
     /// \brief
     ///
-    /// \param pizza
+    /// \param order
+    /// \param recipe
+    /// \param startedAt When the cook got the ingredients and started
     ///
     ///////////////////////////////////////////////////////////////////////////
-    void NotifyPizzaCompletion(const IPizza& pizza);
+    void NotifyPizzaCompletion(
+        const Message::Order& order,
+        const Recipe& recipe,
+        TimePoint startedAt
+    );
 
     ///////////////////////////////////////////////////////////////////////////
     /// \brief
@@ -157,15 +172,38 @@ public:
     /// \return
     ///
     ///////////////////////////////////////////////////////////////////////////
-    std::optional<uint16_t> TryGetNextPizza(Milliseconds timeout);
+    std::optional<Message::Order> TryGetNextPizza(Milliseconds timeout);
 
     ///////////////////////////////////////////////////////////////////////////
     /// \brief
     ///
-    /// \param pizza
+    /// \param order
+    /// \param requeue Given back by a cook, already counted in m_pizzaTime
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void AddPizzaToQueue(const Message::Order& order, bool requeue = false);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Give unstarted pizzas back to the Reception
+    ///
+    /// The most recently queued pizzas are removed first and each one is sent
+    /// back as a Stolen message, after a status reflecting the smaller queue.
+    ///
+    /// \param count
+    /// \param thief Echoed in every Stolen message
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void StealPizzas(size_t count, size_t thief);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Drop the queued pizzas of a cancelled order
+    ///
+    /// Pizzas a cook already took are finished, the Reception ignores them.
+    ///
+    /// \param order
     ///
     ///////////////////////////////////////////////////////////////////////////
-    void AddPizzaToQueue(uint16_t pizza);
+    void CancelOrder(uint32_t order);
 };
 
 } // !namespace Plazza
@@ -2,8 +2,11 @@
 /// Dependencies
 ///////////////////////////////////////////////////////////////////////////////
 #include "Stock.hpp"
-#include "Kitchen/Kitchen.hpp"
+#include "Kitchen/KitchenRuntime.hpp"
+#include "Errors/InvalidArgument.hpp"
 #include "Errors/ParsingException.hpp"
+#include "Utils/Logger.hpp"
+#include <algorithm>
 #include <iostream>
 #include <sstream>
 
@@ -14,16 +17,16 @@ namespace Plazza
 {
 
 ///////////////////////////////////////////////////////////////////////////////
-Stock::Stock(Milliseconds restockTime, Kitchen& kitchen)
+Stock::Stock(Milliseconds restockTime, KitchenRuntime& kitchen)
     : Thread(std::bind(&Stock::Routine, this))
     , m_restockTime(restockTime)
+    , m_stock(PackLanes(
+        IngredientCounts::FromMask(0xFFFF, INITIAL_QUANTITY)
+    ))
     , m_kitchen(kitchen)
+    , m_parked(false)
+    , m_capped(0)
 {
-    for (int i = 0; i < static_cast<int>(Ingredient::SIZE); i++)
-    {
-        m_stock[static_cast<Ingredient>(i)] = 5;
-    }
-
     Start();
 }
 
@@ -32,21 +35,15 @@ Stock::~Stock()
 {}
 
 ///////////////////////////////////////////////////////////////////////////////
-std::map<Ingredient, int> Stock::Unpack(const std::string& stockStr)
+Stock::Quantities Stock::Unpack(const std::string& stockStr)
 {
-    std::map<Ingredient, int> stock;
+    Quantities stock{};
 
     std::stringstream iss(stockStr);
 
-    for (int i = 0; i < static_cast<int>(Ingredient::SIZE); i++)
+    for (auto& quantity : stock)
     {
-        int quantity = 0;
-
-        if ((iss >> quantity))
-        {
-            stock[static_cast<Ingredient>(i)] = quantity;
-        }
-        else
+        if (!(iss >> quantity))
         {
             throw ParsingException("Invalid packed stock");
         }
@@ -56,15 +53,15 @@ std::map<Ingredient, int> Stock::Unpack(const std::string& stockStr)
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-std::string Stock::Pack(void) const
+std::string Stock::Pack(const Quantities& quantities)
 {
     std::string buffer;
 
-    for (int i = 0; i < static_cast<int>(Ingredient::SIZE); i++)
+    for (size_t i = 0; i < INGREDIENT_COUNT; i++)
     {
-        buffer += std::to_string(m_stock.at(static_cast<Ingredient>(i)));
+        buffer += std::to_string(quantities[i]);
 
-        if (i != static_cast<int>(Ingredient::SIZE) - 1)
+        if (i != INGREDIENT_COUNT - 1)
         {
             buffer += ' ';
         }
@@ -74,61 +71,214 @@ std::string Stock::Pack(void) const
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-bool Stock::TryReserveIngredients(const std::vector<Ingredient>& ingredients)
+std::string Stock::Pack(void) const
 {
-    std::unique_lock<std::mutex> lock(m_mutex);
+    return (Pack(UnpackLanes(m_stock.load(std::memory_order_relaxed))));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Lane masks
+///////////////////////////////////////////////////////////////////////////////
+namespace
+{
+
+constexpr uint64_t MakeLaneOnes(void)
+{
+    uint64_t ones = 0;
+
+    for (size_t i = 0; i < Stock::INGREDIENT_COUNT; i++)
+    {
+        ones |= uint64_t(1) << (i * Stock::LANE_BITS);
+    }
+    return (ones);
+}
+
+constexpr uint64_t LANE_ONES = MakeLaneOnes();
+constexpr uint64_t LANE_GUARDS = LANE_ONES << (Stock::LANE_BITS - 1);
+
+static_assert(Stock::INGREDIENT_COUNT * Stock::LANE_BITS <= 64,
+    "Every ingredient needs a lane in the stock word");
+
+}
+
+///////////////////////////////////////////////////////////////////////////////
+uint64_t Stock::PackLanes(const Quantities& quantities)
+{
+    uint64_t lanes = 0;
 
-    for (auto ingredient : ingredients)
+    for (size_t i = 0; i < INGREDIENT_COUNT; i++)
     {
-        if (m_stock[ingredient] <= 0)
+        int32_t quantity = quantities[i];
+
+        if (quantity < 0 || quantity > MAX_QUANTITY)
+        {
+            throw InvalidArgument(
+                "Ingredient quantity " + std::to_string(quantity) +
+                " is outside 0 to " + std::to_string(MAX_QUANTITY)
+            );
+        }
+        lanes |= static_cast<uint64_t>(quantity) << (i * LANE_BITS);
+    }
+    return (lanes);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+Stock::Quantities Stock::UnpackLanes(uint64_t lanes)
+{
+    Quantities quantities;
+
+    for (size_t i = 0; i < INGREDIENT_COUNT; i++)
+    {
+        quantities[i] = static_cast<int32_t>(
+            (lanes >> (i * LANE_BITS)) & MAX_QUANTITY
+        );
+    }
+    return (quantities);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+bool Stock::TryReserve(uint64_t need)
+{
+    uint64_t current = m_stock.load(std::memory_order_relaxed);
+
+    while (true)
+    {
+        // A lane short of its need borrows from its own guard, never
+        // from the next lane, since needs stay below the guard too.
+        uint64_t left = (current | LANE_GUARDS) - need;
+
+        if ((left & LANE_GUARDS) != LANE_GUARDS)
         {
             return (false);
         }
+        if (m_stock.compare_exchange_weak(
+            current, left & ~LANE_GUARDS,
+            std::memory_order_acquire,
+            std::memory_order_relaxed
+        ))
+        {
+            return (true);
+        }
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void Stock::Restock(void)
+{
+    uint64_t current = m_stock.load(std::memory_order_relaxed);
+    uint64_t full = 0;
+
+    while (true)
+    {
+        // Lanes at MAX_QUANTITY would carry into their guard
+        full = (current + LANE_ONES) & LANE_GUARDS;
+        uint64_t next = current + (LANE_ONES & ~(full >> (LANE_BITS - 1)));
+
+        if (m_stock.compare_exchange_weak(
+            current, next,
+            std::memory_order_release,
+            std::memory_order_relaxed
+        ))
+        {
+            break;
+        }
     }
 
-    for (auto ingredient : ingredients)
+    // Told once per ingredient, the first time a unit is withheld
+    uint64_t capped = full & ~m_capped;
+    std::string names;
+
+    for (size_t i = 0; capped && i < INGREDIENT_COUNT; i++)
+    {
+        if (capped & (uint64_t{1} << ((i + 1) * LANE_BITS - 1)))
+        {
+            names += (names.empty() ? "" : ", ");
+            names += INGREDIENT_NAMES[i];
+        }
+    }
+    if (!names.empty())
     {
-        m_stock[ingredient]--;
+        Logger::Warning(
+            "KITCHEN", "Kitchen {}: {} held at {} units, the stock limit",
+            m_kitchen.GetID(), names, MAX_QUANTITY
+        );
     }
+    m_capped |= capped;
+}
 
-    return (true);
+///////////////////////////////////////////////////////////////////////////////
+bool Stock::TryReserveIngredients(const IngredientCounts& needs)
+{
+    return (TryReserve(PackLanes(needs)));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void Stock::ServeWaiters(void)
+{
+    for (auto it = m_waiters.begin(); it != m_waiters.end();)
+    {
+        Waiter* waiter = *it;
+
+        if (TryReserve(waiter->need))
+        {
+            waiter->granted = true;
+            it = m_waiters.erase(it);
+            waiter->cv.NotifyOne();
+        }
+        else
+        {
+            ++it;
+        }
+    }
 }
 
 ///////////////////////////////////////////////////////////////////////////////
 bool Stock::WaitAndReserveIngredients(
-    const std::vector<Ingredient>& ingredients,
+    const IngredientCounts& needs,
     Milliseconds timeout
 )
 {
-    std::unique_lock<std::mutex> lock(m_mutex);
+    uint64_t need = PackLanes(needs);
+
+    if (TryReserve(need))
+    {
+        return (true);
+    }
 
     auto deadline = SteadyClock::Now() + timeout;
+    std::unique_lock<std::mutex> lock(m_mutex);
 
-    while (SteadyClock::Now() < deadline)
+    // The restock thread serves waiters while holding m_mutex, so a refill
+    // that lands after this attempt will find us in the queue.
+    if (TryReserve(need))
     {
-        bool canReserve = true;
-        for (auto ingredient : ingredients)
-        {
-            if (m_stock[ingredient] <= 0)
-            {
-                canReserve = false;
-                break;
-            }
-        }
+        return (true);
+    }
 
-        if (canReserve)
-        {
-            for (auto ingredient : ingredients)
-            {
-                m_stock[ingredient]--;
-            }
-            return (true);
-        }
+    Waiter waiter{need, false, {}};
+    auto it = m_waiters.insert(m_waiters.end(), &waiter);
 
-        m_cv.WaitFor(lock, Milliseconds(100));
+    waiter.cv.GetNativeHandle().wait_until(lock, deadline, [&waiter]
+    {
+        return (waiter.granted);
+    });
+
+    if (!waiter.granted)
+    {
+        m_waiters.erase(it);
     }
 
-    return (false);
+    return (waiter.granted);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void Stock::SetParked(bool parked)
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_parked = parked;
+    }
+    m_parkedCV.NotifyAll();
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -136,14 +286,22 @@ void Stock::Routine(void)
 {
     while (running)
     {
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_parkedCV.GetNativeHandle().wait(lock, [this]
+            {
+                return (!m_parked);
+            });
+        }
+
         std::this_thread::sleep_for(m_restockTime);
 
-        std::lock_guard<std::mutex> lock(m_mutex);
-        for (auto& pair : m_stock)
+        Restock();
+
         {
-            pair.second++;
+            std::lock_guard<std::mutex> lock(m_mutex);
+            ServeWaiters();
         }
-        m_cv.NotifyAll();
         m_kitchen.SendStatus();
     }
 }
@@ -6,13 +6,17 @@
 ///////////////////////////////////////////////////////////////////////////////
 // Dependencies
 ///////////////////////////////////////////////////////////////////////////////
-#include "Pizza/Ingredients.hpp"
+#include "Pizza/IngredientCounts.hpp"
 #include "Concurrency/Thread.hpp"
 #include "Concurrency/CondVar.hpp"
 #include "Utils/Timer.hpp"
+#include <array>
+#include <atomic>
 #include <chrono>
-#include <map>
+#include <cstdint>
+#include <list>
 #include <mutex>
+#include <string>
 
 ///////////////////////////////////////////////////////////////////////////////
 // Namespace Plazza
@@ -23,23 +27,62 @@ namespace Plazza
 ///////////////////////////////////////////////////////////////////////////////
 //
 ///////////////////////////////////////////////////////////////////////////////
-class Kitchen;
+class KitchenRuntime;
 
 ///////////////////////////////////////////////////////////////////////////////
-/// \brief
+/// \brief Ingredients of a kitchen, refilled by their own thread
+///
+/// Quantities live in one atomic word of 7-bit lanes, one per ingredient:
+/// 6 bits of quantity under a guard bit. Subtracting a whole recipe with
+/// every guard set leaves a guard clear exactly where the stock was short,
+/// so a recipe is checked and reserved by a single compare-and-swap.
 ///
 ///////////////////////////////////////////////////////////////////////////////
 class Stock : public Thread
 {
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    //
+    ///////////////////////////////////////////////////////////////////////////
+    static constexpr size_t INGREDIENT_COUNT =
+        static_cast<size_t>(Ingredient::SIZE);
+
+    ///////////////////////////////////////////////////////////////////////////
+    //
+    ///////////////////////////////////////////////////////////////////////////
+    using Quantities = IngredientCounts;
+
+    ///////////////////////////////////////////////////////////////////////////
+    //
+    ///////////////////////////////////////////////////////////////////////////
+    static constexpr size_t LANE_BITS = 7;
+    static constexpr int32_t MAX_QUANTITY = (1 << (LANE_BITS - 1)) - 1;
+    static constexpr int32_t INITIAL_QUANTITY = 5;
+
+private:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief A cook parked until its whole recipe can be reserved
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    struct Waiter
+    {
+        uint64_t need;                              //<! Packed recipe
+        bool granted;                               //<! Reserved on its behalf
+        CondVar cv;                                 //<! Private wakeup
+    };
+
 private:
     ///////////////////////////////////////////////////////////////////////////
     ///
     ///////////////////////////////////////////////////////////////////////////
-    Milliseconds m_restockTime;         //<!
-    std::map<Ingredient, int> m_stock;  //<!
-    Kitchen& m_kitchen;                 //<!
-    Mutex m_mutex;                      //<!
-    CondVar m_cv;                       //<!
+    Milliseconds m_restockTime;                                     //<!
+    std::atomic<uint64_t> m_stock;                                  //<! Packed lanes
+    KitchenRuntime& m_kitchen;                                      //<!
+    Mutex m_mutex;                                                  //<! Guards waiters and m_parked
+    std::list<Waiter*> m_waiters;                                   //<! FIFO of parked cooks
+    bool m_parked;                                                  //<! No restock while set
+    uint64_t m_capped;                                              //<! Guards of lanes reported full
+    CondVar m_parkedCV;                                             //<!
 
 public:
     ///////////////////////////////////////////////////////////////////////////
@@ -48,7 +91,7 @@ public:
     /// \param restockTime
     ///
     ///////////////////////////////////////////////////////////////////////////
-    Stock(Milliseconds restockTime, Kitchen& kitchen);
+    Stock(Milliseconds restockTime, KitchenRuntime& kitchen);
 
     ///////////////////////////////////////////////////////////////////////////
     /// \brief
@@ -65,30 +108,43 @@ public:
     /// \return
     ///
     ///////////////////////////////////////////////////////////////////////////
-    static std::map<Ingredient, int> Unpack(const std::string& stockStr);
+    static Quantities Unpack(const std::string& stockStr);
 
-public:
     ///////////////////////////////////////////////////////////////////////////
     /// \brief
     ///
-    /// \param ingredients
+    /// \param quantities
     ///
     /// \return
     ///
     ///////////////////////////////////////////////////////////////////////////
-    bool TryReserveIngredients(const std::vector<Ingredient>& ingredients);
+    static std::string Pack(const Quantities& quantities);
 
+public:
     ///////////////////////////////////////////////////////////////////////////
-    /// \brief
+    /// \brief Reserve a whole recipe without taking any lock
+    ///
+    /// \param needs
+    ///
+    /// \return True if the whole recipe was reserved, else nothing was
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    bool TryReserveIngredients(const IngredientCounts& needs);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Reserve a recipe, parking the caller until it can be served
+    ///
+    /// A parked cook is only woken once the restock thread has reserved its
+    /// whole recipe for it, or when the timeout expires.
     ///
-    /// \param ingredients
+    /// \param needs
     /// \param timeout
     ///
-    /// \return
+    /// \return True if the whole recipe was reserved
     ///
     ///////////////////////////////////////////////////////////////////////////
     bool WaitAndReserveIngredients(
-        const std::vector<Ingredient>& ingredients,
+        const IngredientCounts& needs,
         Milliseconds timeout
     );
 
@@ -100,7 +156,61 @@ public:
     ///////////////////////////////////////////////////////////////////////////
     std::string Pack(void) const;
 
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Suspend or resume restocking while the kitchen hibernates
+    ///
+    /// \param parked
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void SetParked(bool parked);
+
 private:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param quantities Throws InvalidArgument outside 0 to MAX_QUANTITY
+    ///
+    /// \return The quantities as lanes, guards clear
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static uint64_t PackLanes(const Quantities& quantities);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param lanes
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static Quantities UnpackLanes(uint64_t lanes);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param need Packed by PackLanes
+    ///
+    /// \return True if every lane was taken
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    bool TryReserve(uint64_t need);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Add one unit of every ingredient not at MAX_QUANTITY yet
+    ///
+    /// The first time an ingredient reaches it, a warning says so.
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void Restock(void);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Hand reservations to every parked cook that can now be served
+    ///
+    /// Must be called with m_mutex held.
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void ServeWaiters(void);
+
     ///////////////////////////////////////////////////////////////////////////
     /// \brief
     ///
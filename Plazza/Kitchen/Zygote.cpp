@@ -0,0 +1,251 @@
+///////////////////////////////////////////////////////////////////////////////
+/// Dependencies
+///////////////////////////////////////////////////////////////////////////////
+#include "Kitchen/Zygote.hpp"
+#include "Kitchen/KitchenRuntime.hpp"
+#include "Utils/Timer.hpp"
+#include "Utils/Tracer.hpp"
+#include <stdexcept>
+#include <system_error>
+#include <poll.h>
+#include <signal.h>
+#include <sys/signalfd.h>
+#include <unistd.h>
+
+///////////////////////////////////////////////////////////////////////////////
+/// Namespace Plazza
+///////////////////////////////////////////////////////////////////////////////
+namespace Plazza
+{
+
+///////////////////////////////////////////////////////////////////////////////
+Zygote::Zygote(void)
+    : Process(std::bind(&Zygote::Routine, this))
+    , m_signalFd(-1)
+{
+    Start();
+    m_requests = std::make_unique<Pipe>(
+        std::string(RECEPTION_TO_ZYGOTE_PIPE),
+        Pipe::OpenMode::WRITE_ONLY
+    );
+    m_replies = std::make_unique<Pipe>(
+        std::string(ZYGOTE_TO_RECEPTION_PIPE),
+        Pipe::OpenMode::READ_ONLY
+    );
+    m_requests->Open();
+    m_replies->Open();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+Zygote::~Zygote()
+{
+    if (IsRunning())
+    {
+        m_requests->SendMessage(Message::Closed{0});
+        Wait();
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void Zygote::Routine(void)
+{
+    // A Reception that is gone must not take the zygote down with SIGPIPE.
+    signal(SIGPIPE, SIG_IGN);
+    Tracer::SetRole(Tracer::Role::ZYGOTE);
+    OpenSignalFd();
+
+    m_requests = std::make_unique<Pipe>(
+        std::string(RECEPTION_TO_ZYGOTE_PIPE),
+        Pipe::OpenMode::READ_ONLY
+    );
+    m_replies = std::make_unique<Pipe>(
+        std::string(ZYGOTE_TO_RECEPTION_PIPE),
+        Pipe::OpenMode::WRITE_ONLY
+    );
+    m_toReception = std::make_unique<Pipe>(
+        std::string(KITCHEN_TO_RECEPTION_PIPE),
+        Pipe::OpenMode::WRITE_ONLY
+    );
+    m_requests->Open();
+    m_replies->Open();
+    m_toReception->Open();
+
+    bool running = true;
+
+    while (running)
+    {
+        struct pollfd fds[2] = {
+            {m_requests->GetFileDescriptor(), POLLIN, 0},
+            {m_signalFd, POLLIN, 0}
+        };
+
+        if (poll(fds, 2, 1000) <= 0)
+        {
+            continue;
+        }
+
+        if (fds[1].revents & POLLIN)
+        {
+            ReapChildren();
+        }
+
+        if (fds[0].revents == 0)
+        {
+            continue;
+        }
+
+        while (const auto& message = m_requests->PollMessage())
+        {
+            if (const auto& spawn = message->GetIf<Message::Spawn>())
+            {
+                m_replies->SendMessage(Message::Spawned{
+                    spawn->id, static_cast<int32_t>(Fork(*spawn))
+                });
+            }
+            else if (message->Is<Message::Closed>())
+            {
+                running = false;
+            }
+        }
+
+        if (m_requests->IsHungUp())
+        {
+            running = false;
+        }
+    }
+
+    for (auto& child : m_children)
+    {
+        if (child.process->IsRunning())
+        {
+            child.process->Wait();
+        }
+    }
+    Tracer::Flush();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void Zygote::OpenSignalFd(void)
+{
+    sigset_t mask;
+
+    sigemptyset(&mask);
+    sigaddset(&mask, SIGCHLD);
+
+    if (sigprocmask(SIG_BLOCK, &mask, nullptr) == -1)
+    {
+        throw std::runtime_error("Failed to block SIGCHLD");
+    }
+
+    m_signalFd = signalfd(-1, &mask, SFD_NONBLOCK);
+    if (m_signalFd == -1)
+    {
+        throw std::runtime_error("Failed to open signalfd");
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+pid_t Zygote::Fork(const Message::Spawn& request)
+{
+    auto child = std::make_unique<Process>([this, request]()
+    {
+        sigset_t mask;
+
+        sigemptyset(&mask);
+        sigaddset(&mask, SIGCHLD);
+        sigprocmask(SIG_UNBLOCK, &mask, nullptr);
+        signal(SIGPIPE, SIG_DFL);
+        close(m_signalFd);
+
+        m_requests->Close();
+        m_replies->Close();
+        m_toReception->Close();
+        KitchenRuntime::Run(request);
+    });
+
+    try
+    {
+        child->Start();
+    }
+    catch (const std::exception&)
+    {
+        return (-1);
+    }
+
+    pid_t pid = child->GetPid();
+    m_children.push_back({request.id, std::move(child)});
+    return (pid);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void Zygote::ReapChildren(void)
+{
+    struct signalfd_siginfo info;
+
+    // Signals coalesce, so the count read here means nothing: just drain.
+    while (read(m_signalFd, &info, sizeof(info)) == sizeof(info))
+    {}
+
+    for (auto it = m_children.begin(); it != m_children.end();)
+    {
+        if (it->process->IsRunning())
+        {
+            ++it;
+            continue;
+        }
+
+        bool crashed = it->process->GetStatus() != IProcess::Status::FINISHED
+            || it->process->GetReturnValue() != 0;
+
+        try
+        {
+            m_toReception->SendMessage(Message::Died{it->id, crashed});
+        }
+        catch (const std::system_error&)
+        {
+            // The Reception already closed its end while shutting down.
+        }
+        it = m_children.erase(it);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+pid_t Zygote::Spawn(const Message::Spawn& request)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    m_requests->SendMessage(request);
+
+    auto deadline = SteadyClock::Now() + Seconds(5);
+    while (SteadyClock::Now() < deadline)
+    {
+        if (!m_replies->Wait(Milliseconds(100)))
+        {
+            continue;
+        }
+
+        while (const auto& message = m_replies->PollMessage())
+        {
+            const auto& spawned = message->GetIf<Message::Spawned>();
+            if (spawned && spawned->id == request.id && spawned->pid >= 0)
+            {
+                return (static_cast<pid_t>(spawned->pid));
+            }
+            else if (spawned && spawned->id == request.id)
+            {
+                deadline = SteadyClock::Now();
+            }
+        }
+
+        if (m_replies->IsHungUp())
+        {
+            break;
+        }
+    }
+
+    throw std::runtime_error(
+        "Zygote failed to spawn kitchen " + std::to_string(request.id)
+    );
+}
+
+} // !namespace Plazza
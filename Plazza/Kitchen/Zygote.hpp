@@ -0,0 +1,110 @@
+///////////////////////////////////////////////////////////////////////////////
+// Header guard
+///////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+///////////////////////////////////////////////////////////////////////////////
+// Dependencies
+///////////////////////////////////////////////////////////////////////////////
+#include "Concurrency/Process.hpp"
+#include "Concurrency/Mutex.hpp"
+#include "IPC/Message.hpp"
+#include "IPC/Pipe.hpp"
+#include <memory>
+#include <list>
+
+///////////////////////////////////////////////////////////////////////////////
+// Namespace Plazza
+///////////////////////////////////////////////////////////////////////////////
+namespace Plazza
+{
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Small process forked at startup whose only job is to fork kitchens
+///
+/// The zygote is forked before the Reception, the CLI or any Kitchen object
+/// exists, so the kitchens it forks start from a tiny address space no matter
+/// how large the Reception has grown since. Kitchens forked this way are its
+/// children, not the Reception's: the zygote reaps them as soon as SIGCHLD
+/// arrives on its signalfd and tells the Reception with a Died message.
+///
+///////////////////////////////////////////////////////////////////////////////
+class Zygote : public Process
+{
+private:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief A kitchen process forked by the zygote
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    struct Child
+    {
+        size_t id;                          //<!
+        std::unique_ptr<Process> process;   //<!
+    };
+
+private:
+    ///////////////////////////////////////////////////////////////////////////
+    //
+    ///////////////////////////////////////////////////////////////////////////
+    std::unique_ptr<Pipe> m_requests;                   //<!
+    std::unique_ptr<Pipe> m_replies;                    //<!
+    std::unique_ptr<Pipe> m_toReception;                //<! Zygote side only
+    Mutex m_mutex;                                      //<! Serializes Spawn
+    std::list<Child> m_children;                        //<! Zygote side only
+    int m_signalFd;                                     //<! SIGCHLD, zygote side
+
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    Zygote(void);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    ~Zygote();
+
+private:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void Routine(void);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Fork a kitchen from inside the zygote
+    ///
+    /// \param request
+    ///
+    /// \return The pid of the new kitchen, or -1 if the fork failed
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    pid_t Fork(const Message::Spawn& request);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Block SIGCHLD and open a signalfd to receive it instead
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void OpenSignalFd(void);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Reap every finished kitchen and report it to the Reception
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void ReapChildren(void);
+
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Ask the zygote for a new kitchen and wait for its pid
+    ///
+    /// \param request
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    pid_t Spawn(const Message::Spawn& request);
+};
+
+} // !namespace Plazza
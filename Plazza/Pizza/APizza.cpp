@@ -2,13 +2,8 @@
 // Dependencies
 ///////////////////////////////////////////////////////////////////////////////
 #include "Pizza/APizza.hpp"
-#include "Pizza/Regina.hpp"
-#include "Pizza/Americana.hpp"
-#include "Pizza/Fantasia.hpp"
-#include "Pizza/Margarita.hpp"
+#include "Pizza/Pizza.hpp"
 #include "Errors/InvalidArgument.hpp"
-#include <sstream>
-#include <stdexcept>
 
 ///////////////////////////////////////////////////////////////////////////////
 // Namespace Plazza
@@ -17,115 +12,92 @@ namespace Plazza
 {
 
 ///////////////////////////////////////////////////////////////////////////////
-double APizza::s_cookingTimeMultiplier = 1.0f;
+static const Recipe& FindRecipe(IPizza::Type type, IPizza::Size size)
+{
+    if (const Recipe* recipe = RecipeBook::Find(type, size))
+    {
+        return (*recipe);
+    }
+    throw InvalidArgument("Pizza is not on the menu");
+}
 
 ///////////////////////////////////////////////////////////////////////////////
-APizza::APizza(
-    IPizza::Type type,
-    IPizza::Size size,
-    Seconds baseCookingTime,
-    const std::vector<Ingredient>& ingredients,
-    const std::string& name
-)
-    : m_type(type)
-    , m_size(size)
-    , m_baseCookingTime(baseCookingTime)
-    , m_ingredients(ingredients)
-    , m_name(name)
+APizza::APizza(IPizza::Type type, IPizza::Size size)
+    : m_recipe(FindRecipe(type, size))
 {}
 
 ///////////////////////////////////////////////////////////////////////////////
 IPizza::Type APizza::GetType(void) const
 {
-    return (m_type);
+    return (m_recipe.type);
 }
 
 ///////////////////////////////////////////////////////////////////////////////
 IPizza::Size APizza::GetSize(void) const
 {
-    return (m_size);
+    return (m_recipe.size);
 }
 
 ///////////////////////////////////////////////////////////////////////////////
 Milliseconds APizza::GetCookingTime(void) const
 {
-    return (std::chrono::duration_cast<Milliseconds>(
-        m_baseCookingTime * s_cookingTimeMultiplier
-    ));
+    return (m_recipe.GetCookingTime());
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-const std::vector<Ingredient>& APizza::GetIngredients(void) const
+std::span<const Ingredient> APizza::GetIngredients(void) const
 {
-    return (m_ingredients);
+    return (m_recipe.GetIngredients());
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-void APizza::SetCookingTimeMultiplier(double multiplier)
+const Recipe& APizza::GetRecipe(void) const
 {
-    if (multiplier <= 0.0)
-    {
-        throw InvalidArgument("Cooking time multiplier must be positive");
-    }
+    return (m_recipe);
+}
 
-    s_cookingTimeMultiplier = multiplier;
+///////////////////////////////////////////////////////////////////////////////
+void APizza::SetCookingTimeMultiplier(double multiplier)
+{
+    RecipeBook::SetCookingTimeMultiplier(multiplier);
 }
 
 ///////////////////////////////////////////////////////////////////////////////
 double APizza::GetCookingTimeMultiplier(void)
 {
-    return (s_cookingTimeMultiplier);
+    return (RecipeBook::GetCookingTimeMultiplier());
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-uint16_t APizza::Pack(void) const
+PackedPizza APizza::Pack(void) const
 {
-    uint32_t packedData = 0;
-
-    packedData |= (static_cast<uint32_t>(m_type) << 8);
-    packedData |= (static_cast<uint32_t>(m_size));
-    return (packedData);
+    return (m_recipe.Pack());
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-std::optional<std::unique_ptr<IPizza>> IPizza::Unpack(uint16_t packed)
+PackedPizza IPizza::Pack(IPizza::Type type, IPizza::Size size)
 {
-    IPizza::Type type = static_cast<IPizza::Type>((packed >> 8) & 0xFF);
-    IPizza::Size size = static_cast<IPizza::Size>(packed & 0xFF);
-
-    std::unique_ptr<IPizza> pizzaUniquePtr;
-
-    switch (type) {
-        case IPizza::Type::Regina:
-            pizzaUniquePtr = std::make_unique<Regina>(size); break;
-        case IPizza::Type::Margarita:
-            pizzaUniquePtr = std::make_unique<Margarita>(size); break;
-        case IPizza::Type::Americana:
-            pizzaUniquePtr = std::make_unique<Americana>(size); break;
-        case IPizza::Type::Fantasia:
-            pizzaUniquePtr = std::make_unique<Fantasia>(size); break;
-        default:
-            return (std::nullopt);
-    }
-
-    return (std::make_optional(std::move(pizzaUniquePtr)));
+    return (PackedPizza::Encode(type, size));
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-std::string APizza::SizeToString(IPizza::Size size)
+std::optional<std::unique_ptr<IPizza>> IPizza::Unpack(PackedPizza packed)
 {
-    if (size == IPizza::Size::S) return ("Small");
-    if (size == IPizza::Size::M) return ("Medium");
-    if (size == IPizza::Size::L) return ("Large");
-    if (size == IPizza::Size::XL) return ("Extra Large");
-    if (size == IPizza::Size::XXL) return ("Extra Extra Large");
-    return ("");
+    const Recipe* recipe = RecipeBook::Unpack(packed);
+    if (!recipe)
+    {
+        return (std::nullopt);
+    }
+
+    return (std::make_optional<std::unique_ptr<IPizza>>(
+        std::make_unique<Pizza>(recipe->type, recipe->size)
+    ));
 }
 
 ///////////////////////////////////////////////////////////////////////////////
 std::string APizza::ToString(void) const
 {
-    return (SizeToString(m_size) + " " + m_name);
+    return (m_recipe.ToString());
 }
 
 } // !namespace Plazza
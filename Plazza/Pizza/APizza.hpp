@@ -7,9 +7,7 @@
 // Dependencies
 ///////////////////////////////////////////////////////////////////////////////
 #include "Pizza/IPizza.hpp"
-#include "Pizza/Ingredients.hpp"
-#include <chrono>
-#include <vector>
+#include "Pizza/Recipe.hpp"
 
 ///////////////////////////////////////////////////////////////////////////////
 // Namespace Plazza
@@ -18,7 +16,7 @@ namespace Plazza
 {
 
 ///////////////////////////////////////////////////////////////////////////////
-/// \brief
+/// \brief Pizza object over a shared entry of the RecipeBook
 ///
 ///////////////////////////////////////////////////////////////////////////////
 class APizza : public IPizza
@@ -27,36 +25,17 @@ protected:
     ///////////////////////////////////////////////////////////////////////////
     //
     ///////////////////////////////////////////////////////////////////////////
-    static double s_cookingTimeMultiplier;
-
-protected:
-    ///////////////////////////////////////////////////////////////////////////
-    //
-    ///////////////////////////////////////////////////////////////////////////
-    Type m_type;                            //<!
-    Size m_size;                            //<!
-    Seconds m_baseCookingTime;              //<!
-    std::vector<Ingredient> m_ingredients;  //<!
-    std::string m_name;                     //<!
+    const Recipe& m_recipe;                 //<!
 
 public:
     ///////////////////////////////////////////////////////////////////////////
     /// \brief
     ///
     /// \param type
-    /// \param size
-    /// \param baseCookingTime
-    /// \param ingredients
-    /// \param name
-    ///
-    ///////////////////////////////////////////////////////////////////////////
-    APizza(
-        IPizza::Type type,
-        IPizza::Size size,
-        Seconds baseCookingTime,
-        const std::vector<Ingredient>& ingredients,
-        const std::string& name
-    );
+    /// \param size Throws InvalidArgument if not on the menu
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    APizza(IPizza::Type type, IPizza::Size size);
 
     ///////////////////////////////////////////////////////////////////////////
     /// \brief
@@ -64,25 +43,22 @@ public:
     ///////////////////////////////////////////////////////////////////////////
     virtual ~APizza() = default;
 
-private:
+public:
     ///////////////////////////////////////////////////////////////////////////
     /// \brief
     ///
-    /// \param size
-    ///
     /// \return
     ///
     ///////////////////////////////////////////////////////////////////////////
-    static std::string SizeToString(IPizza::Size size);
+    virtual PackedPizza Pack(void) const override;
 
-public:
     ///////////////////////////////////////////////////////////////////////////
     /// \brief
     ///
     /// \return
     ///
     ///////////////////////////////////////////////////////////////////////////
-    virtual uint16_t Pack(void) const override;
+    virtual Type GetType(void) const override;
 
     ///////////////////////////////////////////////////////////////////////////
     /// \brief
@@ -90,7 +66,7 @@ public:
     /// \return
     ///
     ///////////////////////////////////////////////////////////////////////////
-    virtual Type GetType(void) const override;
+    virtual Size GetSize(void) const override;
 
     ///////////////////////////////////////////////////////////////////////////
     /// \brief
@@ -98,7 +74,7 @@ public:
     /// \return
     ///
     ///////////////////////////////////////////////////////////////////////////
-    virtual Size GetSize(void) const override;
+    virtual Milliseconds GetCookingTime(void) const override;
 
     ///////////////////////////////////////////////////////////////////////////
     /// \brief
@@ -106,7 +82,7 @@ public:
     /// \return
     ///
     ///////////////////////////////////////////////////////////////////////////
-    virtual Milliseconds GetCookingTime(void) const override;
+    virtual std::span<const Ingredient> GetIngredients(void) const override;
 
     ///////////////////////////////////////////////////////////////////////////
     /// \brief
@@ -114,7 +90,7 @@ public:
     /// \return
     ///
     ///////////////////////////////////////////////////////////////////////////
-    virtual  const std::vector<Ingredient>& GetIngredients(void) const override;
+    virtual const Recipe& GetRecipe(void) const override;
 
     ///////////////////////////////////////////////////////////////////////////
     /// \brief
@@ -1,25 +0,0 @@
-///////////////////////////////////////////////////////////////////////////////
-// Dependencies
-///////////////////////////////////////////////////////////////////////////////
-#include "Pizza/Americana.hpp"
-
-///////////////////////////////////////////////////////////////////////////////
-// Namespace Plazza
-///////////////////////////////////////////////////////////////////////////////
-namespace Plazza
-{
-
-///////////////////////////////////////////////////////////////////////////////
-Americana::Americana(IPizza::Size size)
-    : APizza(
-        Type::Americana, size, Seconds(2),
-        {
-            Ingredient::DOUGH,
-            Ingredient::TOMATO,
-            Ingredient::GRUYERE,
-            Ingredient::STEAK
-        }, "Americana"
-    )
-{}
-
-} // !namespace Plazza
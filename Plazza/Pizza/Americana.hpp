@@ -1,39 +0,0 @@
-///////////////////////////////////////////////////////////////////////////////
-// Header guard
-///////////////////////////////////////////////////////////////////////////////
-#pragma once
-
-///////////////////////////////////////////////////////////////////////////////
-// Dependencies
-///////////////////////////////////////////////////////////////////////////////
-#include "Pizza/APizza.hpp"
-
-///////////////////////////////////////////////////////////////////////////////
-// Namespace Plazza
-///////////////////////////////////////////////////////////////////////////////
-namespace Plazza
-{
-
-///////////////////////////////////////////////////////////////////////////////
-/// \brief
-///
-///////////////////////////////////////////////////////////////////////////////
-class Americana : public APizza
-{
-public:
-    ///////////////////////////////////////////////////////////////////////////
-    /// \brief
-    ///
-    /// \param size
-    ///
-    ///////////////////////////////////////////////////////////////////////////
-    Americana(IPizza::Size size);
-
-    ///////////////////////////////////////////////////////////////////////////
-    /// \brief
-    ///
-    ///////////////////////////////////////////////////////////////////////////
-    virtual ~Americana() = default;
-};
-
-} // !namespace Plazza
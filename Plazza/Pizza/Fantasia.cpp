@@ -1,26 +0,0 @@
-///////////////////////////////////////////////////////////////////////////////
-// Dependencies
-///////////////////////////////////////////////////////////////////////////////
-#include "Pizza/Fantasia.hpp"
-
-///////////////////////////////////////////////////////////////////////////////
-// Namespace Plazza
-///////////////////////////////////////////////////////////////////////////////
-namespace Plazza
-{
-
-///////////////////////////////////////////////////////////////////////////////
-Fantasia::Fantasia(IPizza::Size size)
-    : APizza(
-        Type::Fantasia, size, Seconds(4),
-        {
-            Ingredient::DOUGH,
-            Ingredient::TOMATO,
-            Ingredient::EGGPLANT,
-            Ingredient::GOAT_CHEESE,
-            Ingredient::CHIEF_LOVE
-        }, "Fantasia"
-    )
-{}
-
-} // !namespace Plazza
@@ -1,39 +0,0 @@
-///////////////////////////////////////////////////////////////////////////////
-// Header guard
-///////////////////////////////////////////////////////////////////////////////
-#pragma once
-
-///////////////////////////////////////////////////////////////////////////////
-// Dependencies
-///////////////////////////////////////////////////////////////////////////////
-#include "Pizza/APizza.hpp"
-
-///////////////////////////////////////////////////////////////////////////////
-// Namespace Plazza
-///////////////////////////////////////////////////////////////////////////////
-namespace Plazza
-{
-
-///////////////////////////////////////////////////////////////////////////////
-/// \brief
-///
-///////////////////////////////////////////////////////////////////////////////
-class Fantasia : public APizza
-{
-public:
-    ///////////////////////////////////////////////////////////////////////////
-    /// \brief
-    ///
-    /// \param size
-    ///
-    ///////////////////////////////////////////////////////////////////////////
-    Fantasia(IPizza::Size size);
-
-    ///////////////////////////////////////////////////////////////////////////
-    /// \brief
-    ///
-    ///////////////////////////////////////////////////////////////////////////
-    virtual ~Fantasia() = default;
-};
-
-} // !namespace Plazza
@@ -12,6 +12,7 @@
 #include <optional>
 #include <memory>
 #include <chrono>
+#include <span>
 
 ///////////////////////////////////////////////////////////////////////////////
 // Namespace Plazza
@@ -19,6 +20,12 @@
 namespace Plazza
 {
 
+///////////////////////////////////////////////////////////////////////////////
+//
+///////////////////////////////////////////////////////////////////////////////
+struct Recipe;
+class PackedPizza;
+
 ///////////////////////////////////////////////////////////////////////////////
 /// \brief
 ///
@@ -40,15 +47,17 @@ public:
     };
 
     ///////////////////////////////////////////////////////////////////////////
-    /// \brief
+    /// \brief Index of an entry of the loaded menu
+    ///
+    /// Only the entries of the built-in menu are named.
     ///
     ///////////////////////////////////////////////////////////////////////////
-    enum class Type
+    enum class Type : uint16_t
     {
-        Regina = 1,
-        Margarita = 2,
-        Americana = 4,
-        Fantasia = 8
+        Regina = 0,
+        Margarita = 1,
+        Americana = 2,
+        Fantasia = 3
     };
 
 public:
@@ -62,10 +71,10 @@ public:
     ///////////////////////////////////////////////////////////////////////////
     /// \brief
     ///
-    /// \return
+    /// \return The pizza, for no order yet
     ///
     ///////////////////////////////////////////////////////////////////////////
-    virtual uint16_t Pack(void) const = 0;
+    virtual PackedPizza Pack(void) const = 0;
 
     ///////////////////////////////////////////////////////////////////////////
     /// \brief
@@ -97,7 +106,15 @@ public:
     /// \return
     ///
     ///////////////////////////////////////////////////////////////////////////
-    virtual const std::vector<Ingredient>& GetIngredients(void) const = 0;
+    virtual std::span<const Ingredient> GetIngredients(void) const = 0;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \return The shared entry of the RecipeBook
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    virtual const Recipe& GetRecipe(void) const = 0;
 
     ///////////////////////////////////////////////////////////////////////////
     /// \brief
@@ -108,6 +125,17 @@ public:
     virtual std::string ToString(void) const = 0;
 
 public:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Pack a pizza without creating it
+    ///
+    /// \param type
+    /// \param size
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static PackedPizza Pack(Type type, Size size);
+
     ///////////////////////////////////////////////////////////////////////////
     /// \brief
     ///
@@ -116,7 +144,7 @@ public:
     /// \return
     ///
     ///////////////////////////////////////////////////////////////////////////
-    static std::optional<std::unique_ptr<IPizza>> Unpack(uint16_t packed);
+    static std::optional<std::unique_ptr<IPizza>> Unpack(PackedPizza packed);
 };
 
 ///////////////////////////////////////////////////////////////////////////////
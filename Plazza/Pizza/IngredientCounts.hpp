@@ -0,0 +1,110 @@
+///////////////////////////////////////////////////////////////////////////////
+// Header guard
+///////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+///////////////////////////////////////////////////////////////////////////////
+// Dependencies
+///////////////////////////////////////////////////////////////////////////////
+#include "Pizza/Ingredients.hpp"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+///////////////////////////////////////////////////////////////////////////////
+// Namespace Plazza
+///////////////////////////////////////////////////////////////////////////////
+namespace Plazza
+{
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief A quantity per ingredient, handled as one vector of lanes
+///
+/// Every operation walks all lanes without branching or stopping early, so
+/// the compiler turns it into a few SIMD compares, adds or subtracts. Lanes
+/// are padded to a multiple of four with zeros, which -O2 needs to do so.
+/// Lanes stay far from int32_t limits: stock never exceeds a few dozen.
+///
+///////////////////////////////////////////////////////////////////////////////
+class IngredientCounts
+{
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    //
+    ///////////////////////////////////////////////////////////////////////////
+    static constexpr size_t LANES = static_cast<size_t>(Ingredient::SIZE);
+    static constexpr size_t PADDED_LANES = (LANES + 3) & ~size_t(3);
+
+private:
+    ///////////////////////////////////////////////////////////////////////////
+    //
+    ///////////////////////////////////////////////////////////////////////////
+    alignas(16) std::array<int32_t, PADDED_LANES> m_lanes; //<! Padding at 0
+
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Every lane at zero
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    constexpr IngredientCounts(void);
+
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param mask Bit i for Ingredient i
+    /// \param units Put in every lane of the mask
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static constexpr IngredientCounts FromMask(
+        uint16_t mask,
+        int32_t units = 1
+    );
+
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param need
+    ///
+    /// \return True if every lane holds at least the one of need
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    constexpr bool Covers(const IngredientCounts& need) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param need
+    ///
+    /// \return Units missing in the lane that misses the most, or 0
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    constexpr int32_t GetShortfall(const IngredientCounts& need) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    //
+    ///////////////////////////////////////////////////////////////////////////
+    constexpr IngredientCounts& operator+=(const IngredientCounts& other);
+    constexpr IngredientCounts& operator-=(const IngredientCounts& other);
+    constexpr bool operator==(const IngredientCounts& other) const = default;
+
+    ///////////////////////////////////////////////////////////////////////////
+    //
+    ///////////////////////////////////////////////////////////////////////////
+    constexpr int32_t& operator[](size_t lane);
+    constexpr int32_t operator[](size_t lane) const;
+    constexpr int32_t* begin(void);
+    constexpr int32_t* end(void);
+    constexpr const int32_t* begin(void) const;
+    constexpr const int32_t* end(void) const;
+};
+
+} // !namespace Plazza
+
+///////////////////////////////////////////////////////////////////////////////
+//
+///////////////////////////////////////////////////////////////////////////////
+#include "Pizza/IngredientCounts.inl"
@@ -0,0 +1,134 @@
+///////////////////////////////////////////////////////////////////////////////
+// Header guard
+///////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+///////////////////////////////////////////////////////////////////////////////
+// Dependencies
+///////////////////////////////////////////////////////////////////////////////
+#include "Pizza/IngredientCounts.hpp"
+
+///////////////////////////////////////////////////////////////////////////////
+// Namespace Plazza
+///////////////////////////////////////////////////////////////////////////////
+namespace Plazza
+{
+
+///////////////////////////////////////////////////////////////////////////////
+constexpr IngredientCounts::IngredientCounts(void)
+    : m_lanes{}
+{}
+
+///////////////////////////////////////////////////////////////////////////////
+constexpr IngredientCounts IngredientCounts::FromMask(
+    uint16_t mask,
+    int32_t units
+)
+{
+    IngredientCounts counts;
+
+    for (size_t i = 0; i < LANES; i++)
+    {
+        counts.m_lanes[i] = ((mask >> i) & 1) * units;
+    }
+    return (counts);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+constexpr bool IngredientCounts::Covers(const IngredientCounts& need) const
+{
+    int32_t signs = 0;
+
+    // A lane short of need goes negative; OR-ing keeps its sign bit
+    for (size_t i = 0; i < PADDED_LANES; i++)
+    {
+        signs |= m_lanes[i] - need.m_lanes[i];
+    }
+    return (signs >= 0);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+constexpr int32_t IngredientCounts::GetShortfall(
+    const IngredientCounts& need
+) const
+{
+    int32_t shortfall = 0;
+
+    for (size_t i = 0; i < PADDED_LANES; i++)
+    {
+        int32_t missing = need.m_lanes[i] - m_lanes[i];
+
+        shortfall = missing > shortfall ? missing : shortfall;
+    }
+    return (shortfall);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+constexpr IngredientCounts& IngredientCounts::operator+=(
+    const IngredientCounts& other
+)
+{
+    std::array<int32_t, PADDED_LANES> lanes = m_lanes;
+
+    // Through a copy, as other may alias this and stop vectorisation
+    for (size_t i = 0; i < PADDED_LANES; i++)
+    {
+        lanes[i] += other.m_lanes[i];
+    }
+    m_lanes = lanes;
+    return (*this);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+constexpr IngredientCounts& IngredientCounts::operator-=(
+    const IngredientCounts& other
+)
+{
+    std::array<int32_t, PADDED_LANES> lanes = m_lanes;
+
+    // Through a copy, as other may alias this and stop vectorisation
+    for (size_t i = 0; i < PADDED_LANES; i++)
+    {
+        lanes[i] -= other.m_lanes[i];
+    }
+    m_lanes = lanes;
+    return (*this);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+constexpr int32_t& IngredientCounts::operator[](size_t lane)
+{
+    return (m_lanes[lane]);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+constexpr int32_t IngredientCounts::operator[](size_t lane) const
+{
+    return (m_lanes[lane]);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+constexpr int32_t* IngredientCounts::begin(void)
+{
+    return (m_lanes.data());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+constexpr int32_t* IngredientCounts::end(void)
+{
+    return (m_lanes.data() + LANES);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+constexpr const int32_t* IngredientCounts::begin(void) const
+{
+    return (m_lanes.data());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+constexpr const int32_t* IngredientCounts::end(void) const
+{
+    return (m_lanes.data() + LANES);
+}
+
+} // !namespace Plazza
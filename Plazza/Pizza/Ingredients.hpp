@@ -3,6 +3,13 @@
 ///////////////////////////////////////////////////////////////////////////////
 #pragma once
 
+///////////////////////////////////////////////////////////////////////////////
+// Dependencies
+///////////////////////////////////////////////////////////////////////////////
+#include <cstddef>
+#include <iterator>
+#include <string_view>
+
 ///////////////////////////////////////////////////////////////////////////////
 // Namespace Plazza
 ///////////////////////////////////////////////////////////////////////////////
@@ -27,4 +34,16 @@ enum class Ingredient
     SIZE                //<!
 };
 
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Name of each ingredient in menu files, in Ingredient order
+///
+///////////////////////////////////////////////////////////////////////////////
+inline constexpr std::string_view INGREDIENT_NAMES[] = {
+    "dough", "tomato", "gruyere", "ham", "mushroom", "steak",
+    "eggplant", "goat_cheese", "chief_love"
+};
+static_assert(
+    std::size(INGREDIENT_NAMES) == static_cast<size_t>(Ingredient::SIZE)
+);
+
 } // !namespace Plazza
@@ -0,0 +1,151 @@
+///////////////////////////////////////////////////////////////////////////////
+// Header guard
+///////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+///////////////////////////////////////////////////////////////////////////////
+// Dependencies
+///////////////////////////////////////////////////////////////////////////////
+#include "Pizza/IPizza.hpp"
+#include <cstdint>
+
+///////////////////////////////////////////////////////////////////////////////
+// Namespace Plazza
+///////////////////////////////////////////////////////////////////////////////
+namespace Plazza
+{
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief A pizza to cook and the order it belongs to, in one 64-bit word
+///
+/// Bits 0-31 hold the order handle, 32-47 the type and 48-50 the position
+/// of the size among the five. The rest stays zero.
+/// The word travels as is in messages, tickets and kitchen queues, and
+/// every field decodes with a shift and a mask.
+///
+///////////////////////////////////////////////////////////////////////////////
+class PackedPizza
+{
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    //
+    ///////////////////////////////////////////////////////////////////////////
+    static constexpr unsigned int ORDER_SHIFT = 0;
+    static constexpr unsigned int TYPE_SHIFT = 32;
+    static constexpr unsigned int SIZE_SHIFT = 48;
+    static constexpr uint64_t ORDER_MASK = 0xFFFFFFFF;
+    static constexpr uint64_t TYPE_MASK = 0xFFFF;
+    static constexpr uint64_t SIZE_MASK = 0x7;
+
+private:
+    ///////////////////////////////////////////////////////////////////////////
+    //
+    ///////////////////////////////////////////////////////////////////////////
+    uint64_t m_word = 0;    //<!
+
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief An empty word, still trivially copyable for messages
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    PackedPizza(void) = default;
+
+private:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param word
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    constexpr explicit PackedPizza(uint64_t word);
+
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param type
+    /// \param size A single size flag
+    /// \param order
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static constexpr PackedPizza Encode(
+        IPizza::Type type,
+        IPizza::Size size,
+        uint32_t order = 0
+    );
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param word As returned by GetWord
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static constexpr PackedPizza FromWord(uint64_t word);
+
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    constexpr uint64_t GetWord(void) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \return Handle of the customer order
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    constexpr uint32_t GetOrder(void) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \return Index of the menu entry
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    constexpr IPizza::Type GetType(void) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \return 0 for S up to 4 for XXL; above means a corrupt word
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    constexpr size_t GetSizeIndex(void) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    constexpr IPizza::Size GetSize(void) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param order
+    ///
+    /// \return The same pizza, for another order
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    constexpr PackedPizza WithOrder(uint32_t order) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    //
+    ///////////////////////////////////////////////////////////////////////////
+    constexpr bool operator==(const PackedPizza& other) const = default;
+};
+
+} // !namespace Plazza
+
+///////////////////////////////////////////////////////////////////////////////
+//
+///////////////////////////////////////////////////////////////////////////////
+#include "Pizza/PackedPizza.inl"
@@ -0,0 +1,84 @@
+///////////////////////////////////////////////////////////////////////////////
+// Header guard
+///////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+///////////////////////////////////////////////////////////////////////////////
+// Dependencies
+///////////////////////////////////////////////////////////////////////////////
+#include "Pizza/PackedPizza.hpp"
+#include <bit>
+
+///////////////////////////////////////////////////////////////////////////////
+// Namespace Plazza
+///////////////////////////////////////////////////////////////////////////////
+namespace Plazza
+{
+
+///////////////////////////////////////////////////////////////////////////////
+constexpr PackedPizza::PackedPizza(uint64_t word)
+    : m_word(word)
+{}
+
+///////////////////////////////////////////////////////////////////////////////
+constexpr PackedPizza PackedPizza::Encode(
+    IPizza::Type type,
+    IPizza::Size size,
+    uint32_t order
+)
+{
+    uint64_t sizeIndex = std::countr_zero(static_cast<unsigned int>(size));
+
+    return (PackedPizza(
+        (static_cast<uint64_t>(order) << ORDER_SHIFT) |
+        ((static_cast<uint64_t>(type) & TYPE_MASK) << TYPE_SHIFT) |
+        ((sizeIndex & SIZE_MASK) << SIZE_SHIFT)
+    ));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+constexpr PackedPizza PackedPizza::FromWord(uint64_t word)
+{
+    return (PackedPizza(word));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+constexpr uint64_t PackedPizza::GetWord(void) const
+{
+    return (m_word);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+constexpr uint32_t PackedPizza::GetOrder(void) const
+{
+    return (static_cast<uint32_t>((m_word >> ORDER_SHIFT) & ORDER_MASK));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+constexpr IPizza::Type PackedPizza::GetType(void) const
+{
+    return (static_cast<IPizza::Type>((m_word >> TYPE_SHIFT) & TYPE_MASK));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+constexpr size_t PackedPizza::GetSizeIndex(void) const
+{
+    return (static_cast<size_t>((m_word >> SIZE_SHIFT) & SIZE_MASK));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+constexpr IPizza::Size PackedPizza::GetSize(void) const
+{
+    return (static_cast<IPizza::Size>(1u << GetSizeIndex()));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+constexpr PackedPizza PackedPizza::WithOrder(uint32_t order) const
+{
+    return (PackedPizza(
+        (m_word & ~(ORDER_MASK << ORDER_SHIFT)) |
+        (static_cast<uint64_t>(order) << ORDER_SHIFT)
+    ));
+}
+
+} // !namespace Plazza
@@ -1,7 +1,7 @@
 ///////////////////////////////////////////////////////////////////////////////
 // Dependencies
 ///////////////////////////////////////////////////////////////////////////////
-#include "Pizza/Margarita.hpp"
+#include "Pizza/Pizza.hpp"
 
 ///////////////////////////////////////////////////////////////////////////////
 // Namespace Plazza
@@ -10,15 +10,8 @@ namespace Plazza
 {
 
 ///////////////////////////////////////////////////////////////////////////////
-Margarita::Margarita(IPizza::Size size)
-    : APizza(
-        Type::Margarita, size, Seconds(1),
-        {
-            Ingredient::DOUGH,
-            Ingredient::TOMATO,
-            Ingredient::GRUYERE
-        }, "Margarita"
-    )
+Pizza::Pizza(IPizza::Type type, IPizza::Size size)
+    : APizza(type, size)
 {}
 
 } // !namespace Plazza
@@ -15,25 +15,26 @@ namespace Plazza
 {
 
 ///////////////////////////////////////////////////////////////////////////////
-/// \brief
+/// \brief Any pizza of the loaded menu
 ///
 ///////////////////////////////////////////////////////////////////////////////
-class Margarita : public APizza
+class Pizza : public APizza
 {
 public:
     ///////////////////////////////////////////////////////////////////////////
     /// \brief
     ///
+    /// \param type
     /// \param size
     ///
     ///////////////////////////////////////////////////////////////////////////
-    Margarita(IPizza::Size size);
+    Pizza(IPizza::Type type, IPizza::Size size);
 
     ///////////////////////////////////////////////////////////////////////////
     /// \brief
     ///
     ///////////////////////////////////////////////////////////////////////////
-    virtual ~Margarita() = default;
+    virtual ~Pizza() = default;
 };
 
 } // !namespace Plazza
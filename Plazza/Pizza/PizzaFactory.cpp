@@ -2,10 +2,8 @@
 // Dependencies
 ///////////////////////////////////////////////////////////////////////////////
 #include "Pizza/PizzaFactory.hpp"
-#include "Pizza/Margarita.hpp"
-#include "Pizza/Americana.hpp"
-#include "Pizza/Regina.hpp"
-#include "Pizza/Fantasia.hpp"
+#include "Pizza/Pizza.hpp"
+#include "Pizza/Recipe.hpp"
 
 ///////////////////////////////////////////////////////////////////////////////
 // Namespace Plazza
@@ -13,44 +11,37 @@
 namespace Plazza
 {
 
-///////////////////////////////////////////////////////////////////////////////
-PizzaFactory::PizzaFactory(void)
-{
-    RegisterPizza<Regina>("regina");
-    RegisterPizza<Fantasia>("fantasia");
-    RegisterPizza<Americana>("americana");
-    RegisterPizza<Margarita>("margarita");
-}
-
 ///////////////////////////////////////////////////////////////////////////////
 std::unique_ptr<IPizza> PizzaFactory::CreatePizza(
-    const std::string& type,
+    std::string_view type,
     IPizza::Size size
 )
 {
-    if (!HasFactory(type))
+    auto found = RecipeBook::FindType(type);
+
+    if (!found || !RecipeBook::Find(found.value(), size))
     {
         return (nullptr);
     }
-    return (m_factories[type](size));
+    return (std::make_unique<Pizza>(found.value(), size));
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-std::vector<std::string> PizzaFactory::GetFactoryList(void) const
+std::vector<std::string> PizzaFactory::GetFactoryList(void)
 {
-    std::vector<std::string> factories;
+    return (RecipeBook::GetTypeNames());
+}
 
-    for (const auto& [key, value] : m_factories)
-    {
-        factories.push_back(key);
-    }
-    return (factories);
+///////////////////////////////////////////////////////////////////////////////
+bool PizzaFactory::HasFactory(std::string_view type)
+{
+    return (RecipeBook::FindType(type).has_value());
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-bool PizzaFactory::HasFactory(const std::string& type) const
+std::optional<IPizza::Type> PizzaFactory::GetType(std::string_view type)
 {
-    return (m_factories.count(type) != 0);
+    return (RecipeBook::FindType(type));
 }
 
 } // !namespace Plazza
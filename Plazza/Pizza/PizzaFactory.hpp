@@ -8,8 +8,8 @@
 ///////////////////////////////////////////////////////////////////////////////
 #include "Pizza/IPizza.hpp"
 #include "Utils/Singleton.hpp"
-#include <unordered_map>
-#include <functional>
+#include <optional>
+#include <string_view>
 #include <memory>
 #include <vector>
 
@@ -20,25 +20,20 @@ namespace Plazza
 {
 
 ///////////////////////////////////////////////////////////////////////////////
-/// \brief
+/// \brief Creates pizzas by name, from the entries of the RecipeBook
+///
+/// Lookups are static and go through the RecipeBook's perfect hash, so hot
+/// paths need neither the instance nor its lock.
 ///
 ///////////////////////////////////////////////////////////////////////////////
 class PizzaFactory : public Singleton<PizzaFactory>
 {
-private:
-    ///////////////////////////////////////////////////////////////////////////
-    //
-    ///////////////////////////////////////////////////////////////////////////
-    std::unordered_map<
-        std::string, std::function<std::unique_ptr<IPizza>(IPizza::Size)>
-    > m_factories;          //<!
-
 public:
     ///////////////////////////////////////////////////////////////////////////
     /// \brief
     ///
     ///////////////////////////////////////////////////////////////////////////
-    PizzaFactory(void);
+    PizzaFactory(void) = default;
 
     ///////////////////////////////////////////////////////////////////////////
     /// \brief
@@ -53,21 +48,21 @@ public:
     /// \param type
     /// \param size
     ///
-    /// \return
+    /// \return Null if the type is not on the menu
     ///
     ///////////////////////////////////////////////////////////////////////////
-    std::unique_ptr<IPizza> CreatePizza(
-        const std::string& type,
+    static std::unique_ptr<IPizza> CreatePizza(
+        std::string_view type,
         IPizza::Size size
     );
 
     ///////////////////////////////////////////////////////////////////////////
     /// \brief
     ///
-    /// \return
+    /// \return Every type name, in menu order
     ///
     ///////////////////////////////////////////////////////////////////////////
-    std::vector<std::string> GetFactoryList(void) const;
+    static std::vector<std::string> GetFactoryList(void);
 
     ///////////////////////////////////////////////////////////////////////////
     /// \brief
@@ -77,22 +72,17 @@ public:
     /// \return
     ///
     ///////////////////////////////////////////////////////////////////////////
-    bool HasFactory(const std::string& type) const;
+    static bool HasFactory(std::string_view type);
 
-private:
     ///////////////////////////////////////////////////////////////////////////
-    /// \brief
+    /// \brief Look a pizza type up by name, without creating a pizza
     ///
     /// \param type
     ///
+    /// \return
+    ///
     ///////////////////////////////////////////////////////////////////////////
-    template <typename T>
-    void RegisterPizza(const std::string& type);
+    static std::optional<IPizza::Type> GetType(std::string_view type);
 };
 
 } // !namespace Plazza
-
-///////////////////////////////////////////////////////////////////////////////
-//
-///////////////////////////////////////////////////////////////////////////////
-#include "Pizza/PizzaFactory.inl"
@@ -0,0 +1,351 @@
+///////////////////////////////////////////////////////////////////////////////
+// Dependencies
+///////////////////////////////////////////////////////////////////////////////
+#include "Pizza/Recipe.hpp"
+#include "Errors/InvalidArgument.hpp"
+#include "Errors/ParsingException.hpp"
+#include <algorithm>
+#include <cctype>
+#include <charconv>
+#include <cmath>
+#include <fstream>
+#include <sstream>
+
+///////////////////////////////////////////////////////////////////////////////
+// Namespace Plazza
+///////////////////////////////////////////////////////////////////////////////
+namespace Plazza
+{
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief
+///
+/// \param line
+///
+/// \return The words of a line, up to a `#` comment
+///
+///////////////////////////////////////////////////////////////////////////////
+static std::vector<std::string_view> SplitWords(std::string_view line)
+{
+    std::vector<std::string_view> words;
+
+    line = line.substr(0, line.find('#'));
+    for (size_t i = 0; i < line.size();)
+    {
+        if (std::isspace(static_cast<unsigned char>(line[i])))
+        {
+            i++;
+            continue;
+        }
+
+        size_t start = i;
+        while (i < line.size() && !std::isspace(static_cast<unsigned char>(
+            line[i])))
+        {
+            i++;
+        }
+        words.push_back(line.substr(start, i - start));
+    }
+    return (words);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief
+///
+/// \param word
+///
+/// \return The positive number it spells, or nullopt
+///
+///////////////////////////////////////////////////////////////////////////////
+static std::optional<double> ParsePositive(std::string_view word)
+{
+    double value = 0.0;
+    auto [end, error] = std::from_chars(
+        word.data(), word.data() + word.size(), value
+    );
+
+    if (error != std::errc() || end != word.data() + word.size() ||
+        !(value > 0.0) || value > 1e6)
+    {
+        return (std::nullopt);
+    }
+    return (value);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief
+///
+/// \param name
+///
+/// \return True for a letter followed by letters, digits or underscores,
+/// which the order parser reads as one word
+///
+///////////////////////////////////////////////////////////////////////////////
+static bool IsValidName(std::string_view name)
+{
+    auto isWordChar = [](char c) {
+        return (std::isalnum(static_cast<unsigned char>(c)) || c == '_');
+    };
+
+    return (!name.empty() && std::isalpha(static_cast<unsigned char>(name[0]))
+        && std::all_of(name.begin(), name.end(), isWordChar));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief
+///
+/// \param name
+///
+/// \return "goat_cheese" shown as "Goat cheese"
+///
+///////////////////////////////////////////////////////////////////////////////
+static std::string MakeLabel(std::string_view name)
+{
+    std::string label(name);
+
+    std::replace(label.begin(), label.end(), '_', ' ');
+    label[0] = static_cast<char>(
+        std::toupper(static_cast<unsigned char>(label[0]))
+    );
+    return (label);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+std::string_view RecipeBook::s_source = RecipeBook::DEFAULT_MENU;
+
+///////////////////////////////////////////////////////////////////////////////
+bool RecipeBook::s_fixed = false;
+
+///////////////////////////////////////////////////////////////////////////////
+double RecipeBook::s_cookingTimeMultiplier = 1.0;
+
+///////////////////////////////////////////////////////////////////////////////
+Milliseconds Recipe::GetCookingTime(void) const
+{
+    return (std::chrono::duration_cast<Milliseconds>(
+        baseCookingTime * RecipeBook::GetCookingTimeMultiplier()
+    ));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+std::string Recipe::ToString(void) const
+{
+    std::string label;
+
+    label.reserve(sizeName.size() + 1 + name.size());
+    label.append(sizeName).append(" ").append(name);
+    return (label);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+RecipeBook::Menu RecipeBook::Parse(std::string_view text)
+{
+    struct Entry
+    {
+        std::string_view name;
+        double seconds;
+        uint16_t ingredients;
+    };
+    std::vector<Entry> entries;
+    std::array<double, SIZE_COUNT> factors = {1.0, 1.0, 1.0, 1.0, 1.0};
+    bool scaled = false;
+    size_t number = 0;
+
+    for (size_t start = 0; start < text.size(); number++)
+    {
+        size_t end = std::min(text.find('\n', start), text.size());
+        std::vector<std::string_view> words = SplitWords(
+            text.substr(start, end - start)
+        );
+        std::string at = "menu line " + std::to_string(number + 1) + ": ";
+
+        start = end + 1;
+        if (words.empty())
+        {
+            continue;
+        }
+
+        if (words[0] == "sizes")
+        {
+            if (scaled || words.size() != SIZE_COUNT + 1)
+            {
+                throw ParsingException(
+                    at + "expected a single 'sizes S M L XL XXL' line"
+                );
+            }
+            for (size_t i = 0; i < SIZE_COUNT; i++)
+            {
+                auto factor = ParsePositive(words[i + 1]);
+                if (!factor)
+                {
+                    throw ParsingException(
+                        at + "invalid size factor '" +
+                        std::string(words[i + 1]) + "'"
+                    );
+                }
+                factors[i] = factor.value();
+            }
+            scaled = true;
+            continue;
+        }
+
+        if (!IsValidName(words[0]))
+        {
+            throw ParsingException(
+                at + "invalid pizza name '" + std::string(words[0]) + "'"
+            );
+        }
+        for (const Entry& entry : entries)
+        {
+            if (entry.name == words[0])
+            {
+                throw ParsingException(
+                    at + "'" + std::string(words[0]) + "' is already listed"
+                );
+            }
+        }
+        if (words.size() < 3)
+        {
+            throw ParsingException(
+                at + "expected NAME SECONDS INGREDIENT..."
+            );
+        }
+
+        auto seconds = ParsePositive(words[1]);
+        if (!seconds)
+        {
+            throw ParsingException(
+                at + "invalid cooking time '" + std::string(words[1]) + "'"
+            );
+        }
+
+        uint16_t mask = 0;
+        for (size_t i = 2; i < words.size(); i++)
+        {
+            auto known = std::find(
+                std::begin(INGREDIENT_NAMES), std::end(INGREDIENT_NAMES),
+                words[i]
+            );
+            uint16_t bit = static_cast<uint16_t>(
+                1u << (known - std::begin(INGREDIENT_NAMES))
+            );
+
+            if (known == std::end(INGREDIENT_NAMES) || (mask & bit))
+            {
+                throw ParsingException(
+                    at + "unknown or repeated ingredient '" +
+                    std::string(words[i]) + "'"
+                );
+            }
+            mask |= bit;
+        }
+
+        if (entries.size() == MAX_TYPES)
+        {
+            throw ParsingException(
+                at + "a menu holds at most " + std::to_string(MAX_TYPES) +
+                " pizzas"
+            );
+        }
+        entries.push_back({words[0], seconds.value(), mask});
+    }
+
+    if (entries.empty())
+    {
+        throw ParsingException("menu lists no pizza");
+    }
+
+    Menu menu;
+    std::vector<std::string> names;
+
+    for (const Entry& entry : entries)
+    {
+        names.emplace_back(entry.name);
+    }
+    menu.types = PerfectHash(std::move(names));
+
+    menu.table.reserve(entries.size() * SIZE_COUNT);
+    for (size_t type = 0; type < entries.size(); type++)
+    {
+        for (size_t i = 0; i < SIZE_COUNT; i++)
+        {
+            menu.table.push_back(MakeRecipe(
+                static_cast<IPizza::Type>(type),
+                static_cast<IPizza::Size>(1u << i),
+                Milliseconds(std::llround(
+                    entries[type].seconds * factors[i] * 1000.0
+                )),
+                MakeLabel(entries[type].name),
+                entries[type].ingredients
+            ));
+        }
+    }
+    return (menu);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void RecipeBook::Load(std::string_view text)
+{
+    static std::string loaded;
+
+    if (s_fixed)
+    {
+        throw InvalidArgument("The menu can only be loaded once, before use");
+    }
+    // Parsed now to report errors here; built for good on first use
+    Parse(text);
+    loaded = text;
+    s_source = loaded;
+    s_fixed = true;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void RecipeBook::LoadFile(const std::string& path)
+{
+    std::ifstream file(path);
+    std::stringstream text;
+
+    if (!file)
+    {
+        throw InvalidArgument("Cannot read menu file " + path);
+    }
+    text << file.rdbuf();
+    Load(text.str());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+const std::vector<std::string>& RecipeBook::GetTypeNames(void)
+{
+    return (GetMenu().types.GetKeys());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+std::optional<IPizza::Type> RecipeBook::FindType(std::string_view name)
+{
+    uint32_t index = GetMenu().types.Find(name);
+
+    if (index == PerfectHash::NOT_FOUND)
+    {
+        return (std::nullopt);
+    }
+    return (static_cast<IPizza::Type>(index));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void RecipeBook::SetCookingTimeMultiplier(double multiplier)
+{
+    if (multiplier <= 0.0)
+    {
+        throw InvalidArgument("Cooking time multiplier must be positive");
+    }
+
+    s_cookingTimeMultiplier = multiplier;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+double RecipeBook::GetCookingTimeMultiplier(void)
+{
+    return (s_cookingTimeMultiplier);
+}
+
+} // !namespace Plazza
@@ -0,0 +1,280 @@
+///////////////////////////////////////////////////////////////////////////////
+// Header guard
+///////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+///////////////////////////////////////////////////////////////////////////////
+// Dependencies
+///////////////////////////////////////////////////////////////////////////////
+#include "Pizza/IPizza.hpp"
+#include "Pizza/Ingredients.hpp"
+#include "Pizza/IngredientCounts.hpp"
+#include "Pizza/PackedPizza.hpp"
+#include "Utils/PerfectHash.hpp"
+#include "Utils/Timer.hpp"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+// Namespace Plazza
+///////////////////////////////////////////////////////////////////////////////
+namespace Plazza
+{
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief What one type and size of pizza needs, shared by every pizza of it
+///
+///////////////////////////////////////////////////////////////////////////////
+struct Recipe
+{
+    ///////////////////////////////////////////////////////////////////////////
+    //
+    ///////////////////////////////////////////////////////////////////////////
+    static constexpr size_t MAX_INGREDIENTS =
+        static_cast<size_t>(Ingredient::SIZE);
+
+    ///////////////////////////////////////////////////////////////////////////
+    //
+    ///////////////////////////////////////////////////////////////////////////
+    IPizza::Type type;                          //<!
+    IPizza::Size size;                          //<!
+    uint16_t ingredients;                       //<! Bit i for Ingredient i
+    IngredientCounts needs;                     //<! Units per ingredient
+    Milliseconds baseCookingTime;               //<! Scaled for the size
+    std::string name;                           //<! Such as "Regina"
+    std::string_view sizeName;                  //<! Such as "Small"
+    std::array<Ingredient, MAX_INGREDIENTS> ingredientList; //<! Enum order
+    size_t ingredientCount;                     //<!
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \return The ingredients of the mask, one unit each
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    constexpr std::span<const Ingredient> GetIngredients(void) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param order
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    constexpr PackedPizza Pack(uint32_t order = 0) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \return The base time scaled by the cooking time multiplier
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    Milliseconds GetCookingTime(void) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \return Such as "Small Regina"
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    std::string ToString(void) const;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief The menu, as a table of recipes indexed by type and size
+///
+/// Loaded once at startup, from a menu file or the built-in menu, before
+/// any thread or kitchen exists; read-only after that. Looking a pizza up
+/// by type and size is a couple of bit operations and an array access, and
+/// by name a perfect hash lookup. Nothing locks and nothing is allocated.
+///
+/// A menu file holds one pizza per line, `NAME SECONDS INGREDIENT...`, and
+/// at most one `sizes S M L XL XXL` line of cooking time factors, 1 by
+/// default. `#` starts a comment.
+///
+///////////////////////////////////////////////////////////////////////////////
+class RecipeBook
+{
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    //
+    ///////////////////////////////////////////////////////////////////////////
+    static constexpr size_t SIZE_COUNT = 5;
+    static constexpr size_t MAX_TYPES = 4096;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Menu used when none is loaded
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static constexpr std::string_view DEFAULT_MENU =
+        "regina     2 dough tomato gruyere ham mushroom\n"
+        "margarita  1 dough tomato gruyere\n"
+        "americana  2 dough tomato gruyere steak\n"
+        "fantasia   4 dough tomato eggplant goat_cheese chief_love\n";
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief A parsed menu
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    struct Menu
+    {
+        PerfectHash types;                  //<! Type of each lookup name
+        std::vector<Recipe> table;          //<! By type, then size
+    };
+
+private:
+    ///////////////////////////////////////////////////////////////////////////
+    //
+    ///////////////////////////////////////////////////////////////////////////
+    static std::string_view s_source;       //<! Text the menu is built from
+    static bool s_fixed;                    //<! Loaded or used, final
+    static double s_cookingTimeMultiplier;
+
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    RecipeBook(void) = delete;
+
+private:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param size
+    ///
+    /// \return Position of the size among the five, or SIZE_COUNT if it is
+    /// not a single known flag
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static constexpr size_t GetSizeIndex(IPizza::Size size);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param type
+    /// \param size
+    /// \param baseCookingTime
+    /// \param name
+    /// \param ingredients
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static constexpr Recipe MakeRecipe(
+        IPizza::Type type,
+        IPizza::Size size,
+        Milliseconds baseCookingTime,
+        std::string_view name,
+        uint16_t ingredients
+    );
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief The menu, built from s_source on first use
+    ///
+    /// Pizzas and recipes refer into it, so it is never replaced after.
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static const Menu& GetMenu(void);
+
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param text Contents of a menu file
+    ///
+    /// \return Throws ParsingException naming the line at fault
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static Menu Parse(std::string_view text);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Use another menu than the built-in one
+    ///
+    /// Only once, and before any pizza is looked up: throws InvalidArgument
+    /// after that, since live pizzas refer to the recipes in use.
+    ///
+    /// \param text Contents of a menu file
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static void Load(std::string_view text);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param path Throws InvalidArgument if it cannot be read
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static void LoadFile(const std::string& path);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \return Lookup names, by type
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static const std::vector<std::string>& GetTypeNames(void);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param name Case sensitive, such as "regina"
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static std::optional<IPizza::Type> FindType(std::string_view name);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param type
+    /// \param size
+    ///
+    /// \return Null if the pizza is not on the menu
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static const Recipe* Find(IPizza::Type type, IPizza::Size size);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Recipe of a packed pizza, straight from its fields
+    ///
+    /// \param packed
+    ///
+    /// \return Null if the pizza is not on the menu
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static const Recipe* Unpack(PackedPizza packed);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param multiplier
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static void SetCookingTimeMultiplier(double multiplier);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static double GetCookingTimeMultiplier(void);
+};
+
+} // !namespace Plazza
+
+///////////////////////////////////////////////////////////////////////////////
+//
+///////////////////////////////////////////////////////////////////////////////
+#include "Pizza/Recipe.inl"
@@ -0,0 +1,117 @@
+///////////////////////////////////////////////////////////////////////////////
+// Header guard
+///////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+///////////////////////////////////////////////////////////////////////////////
+// Dependencies
+///////////////////////////////////////////////////////////////////////////////
+#include "Pizza/Recipe.hpp"
+#include <bit>
+
+///////////////////////////////////////////////////////////////////////////////
+// Namespace Plazza
+///////////////////////////////////////////////////////////////////////////////
+namespace Plazza
+{
+
+///////////////////////////////////////////////////////////////////////////////
+constexpr std::span<const Ingredient> Recipe::GetIngredients(void) const
+{
+    return (std::span<const Ingredient>(
+        ingredientList.data(), ingredientCount
+    ));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+constexpr PackedPizza Recipe::Pack(uint32_t order) const
+{
+    return (PackedPizza::Encode(type, size, order));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+constexpr size_t RecipeBook::GetSizeIndex(IPizza::Size size)
+{
+    auto bits = static_cast<unsigned int>(size);
+
+    if (!std::has_single_bit(bits) || bits >= (1u << SIZE_COUNT))
+    {
+        return (SIZE_COUNT);
+    }
+    return (std::countr_zero(bits));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+constexpr Recipe RecipeBook::MakeRecipe(
+    IPizza::Type type,
+    IPizza::Size size,
+    Milliseconds baseCookingTime,
+    std::string_view name,
+    uint16_t ingredients
+)
+{
+    constexpr std::string_view SIZE_NAMES[SIZE_COUNT] = {
+        "Small", "Medium", "Large", "Extra Large", "Extra Extra Large"
+    };
+    Recipe recipe{
+        type, size, ingredients, IngredientCounts::FromMask(ingredients),
+        baseCookingTime, std::string(name),
+        SIZE_NAMES[std::countr_zero(static_cast<unsigned int>(size))],
+        {}, 0
+    };
+
+    for (size_t i = 0; i < Recipe::MAX_INGREDIENTS; i++)
+    {
+        if (ingredients & (1u << i))
+        {
+            recipe.ingredientList[recipe.ingredientCount++] =
+                static_cast<Ingredient>(i);
+        }
+    }
+    return (recipe);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+inline const RecipeBook::Menu& RecipeBook::GetMenu(void)
+{
+    // Local, so no other translation unit's static can see it unbuilt
+    static const Menu menu = []() {
+        s_fixed = true;
+        return (Parse(s_source));
+    }();
+
+    return (menu);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+inline const Recipe* RecipeBook::Find(IPizza::Type type, IPizza::Size size)
+{
+    size_t sizeIndex = GetSizeIndex(size);
+    size_t index = static_cast<size_t>(type) * SIZE_COUNT + sizeIndex;
+
+    const Menu& menu = GetMenu();
+
+    if (sizeIndex == SIZE_COUNT || index >= menu.table.size())
+    {
+        return (nullptr);
+    }
+    return (&menu.table[index]);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+inline const Recipe* RecipeBook::Unpack(PackedPizza packed)
+{
+    size_t sizeIndex = packed.GetSizeIndex();
+    size_t index = static_cast<size_t>(packed.GetType()) * SIZE_COUNT +
+        sizeIndex;
+
+    const Menu& menu = GetMenu();
+
+    if (sizeIndex >= SIZE_COUNT || index >= menu.table.size())
+    {
+        return (nullptr);
+    }
+    return (&menu.table[index]);
+}
+
+} // !namespace Plazza
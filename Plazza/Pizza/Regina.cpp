@@ -1,26 +0,0 @@
-///////////////////////////////////////////////////////////////////////////////
-// Dependencies
-///////////////////////////////////////////////////////////////////////////////
-#include "Pizza/Regina.hpp"
-
-///////////////////////////////////////////////////////////////////////////////
-// Namespace Plazza
-///////////////////////////////////////////////////////////////////////////////
-namespace Plazza
-{
-
-///////////////////////////////////////////////////////////////////////////////
-Regina::Regina(IPizza::Size size)
-    : APizza(
-        Type::Regina, size, Seconds(2),
-        {
-            Ingredient::DOUGH,
-            Ingredient::TOMATO,
-            Ingredient::GRUYERE,
-            Ingredient::HAM,
-            Ingredient::MUSHROOM
-        }, "Regina"
-    )
-{}
-
-} // !namespace Plazza
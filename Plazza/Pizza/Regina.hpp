@@ -1,39 +0,0 @@
-///////////////////////////////////////////////////////////////////////////////
-// Header guard
-///////////////////////////////////////////////////////////////////////////////
-#pragma once
-
-///////////////////////////////////////////////////////////////////////////////
-// Dependencies
-///////////////////////////////////////////////////////////////////////////////
-#include "Pizza/APizza.hpp"
-
-///////////////////////////////////////////////////////////////////////////////
-// Namespace Plazza
-///////////////////////////////////////////////////////////////////////////////
-namespace Plazza
-{
-
-///////////////////////////////////////////////////////////////////////////////
-/// \brief
-///
-///////////////////////////////////////////////////////////////////////////////
-class Regina : public APizza
-{
-public:
-    ///////////////////////////////////////////////////////////////////////////
-    /// \brief
-    ///
-    /// \param size
-    ///
-    ///////////////////////////////////////////////////////////////////////////
-    Regina(IPizza::Size size);
-
-    ///////////////////////////////////////////////////////////////////////////
-    /// \brief
-    ///
-    ///////////////////////////////////////////////////////////////////////////
-    virtual ~Regina() = default;
-};
-
-} // !namespace Plazza
@@ -3,8 +3,12 @@
 ///////////////////////////////////////////////////////////////////////////////
 #include "Reception/CLI.hpp"
 #include "Reception/Parser.hpp"
+#include "Reception/OrderReader.hpp"
 #include "Errors/ParsingException.hpp"
 #include "Utils/Logger.hpp"
+#include "Utils/Tracer.hpp"
+#include "Utils/Timer.hpp"
+#include <cstdio>
 #include <iostream>
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -32,7 +36,7 @@ void CLI::Run(void)
     std::cout << "Welcome to Plazza!" << std::endl;
     std::cout << "Enter pizza orders "
               << "(e.g., 'regina XXL x1; margarita S x2') "
-              << "or 'status' or 'exit'."
+              << "or 'status', 'stats' or 'exit'."
               << std::endl;
 
     while (true)
@@ -52,7 +56,7 @@ void CLI::Run(void)
             continue;
         }
 
-        Logger::Debug("CLI", "Command entered: '" + command + "'");
+        Logger::Debug("CLI", "Command entered: '{}'", command);
 
         if (command == "exit")
         {
@@ -64,6 +68,79 @@ void CLI::Run(void)
     }
 }
 
+///////////////////////////////////////////////////////////////////////////////
+void CLI::RunBatch(const std::string& path, size_t backlog)
+{
+    OrderReader reader(path);
+    TimePoint start = SteadyClock::Now();
+    uint64_t lines = 0;
+    uint64_t rejected = 0;
+    uint64_t pizzas = 0;
+
+    Logger::Info("CLI", "Reading orders from {}", path);
+
+    while (auto chunk = reader.NextChunk())
+    {
+        m_parser.ParseLines(chunk.value(),
+            [&](const ParallelParser::ParsedLine& line) {
+                std::string error = line.error;
+
+                lines++;
+                if (line.skipped)
+                {
+                    return;
+                }
+                if (line.deferred)
+                {
+                    try
+                    {
+                        ProcessLargeOrder(line.text, pizzas, backlog);
+                    }
+                    catch (const ParsingException& e)
+                    {
+                        error = e.what();
+                    }
+                }
+                else if (error.empty())
+                {
+                    pizzas += Parser::CountPizzas(line.orders);
+                    m_reception.ProcessOrders(line.orders, backlog);
+                }
+
+                if (!error.empty())
+                {
+                    rejected++;
+                    Logger::Error("CLI", "Line {}: {}", lines, error);
+                    std::cerr << path << ":" << lines << ": " << error
+                              << std::endl;
+                }
+            });
+    }
+
+    TimePoint read = SteadyClock::Now();
+    m_reception.WaitForBacklog(0);
+    TimePoint done = SteadyClock::Now();
+
+    double seconds = std::chrono::duration<double>(done - start).count();
+    double readSeconds = std::chrono::duration<double>(read - start).count();
+    char summary[256];
+
+    std::snprintf(summary, sizeof(summary),
+        "%llu line(s), %llu rejected, %llu bytes read in %.3fs\n"
+        "%llu pizza(s) cooked in %.3fs: %.1f pizza(s)/s, %.1f line(s)/s",
+        static_cast<unsigned long long>(lines),
+        static_cast<unsigned long long>(rejected),
+        static_cast<unsigned long long>(reader.GetBytesRead()), readSeconds,
+        static_cast<unsigned long long>(pizzas), seconds,
+        seconds > 0.0 ? static_cast<double>(pizzas) / seconds : 0.0,
+        seconds > 0.0 ? static_cast<double>(lines) / seconds : 0.0);
+    std::cout << summary << std::endl;
+    Logger::Info(
+        "CLI", "Batch done: {} line(s), {} rejected, {} pizza(s) in {}ms",
+        lines, rejected, pizzas, SteadyClock::DurationToMs(done - start)
+    );
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 void CLI::ProcessCommand(const std::string& line)
 {
@@ -71,12 +148,27 @@ void CLI::ProcessCommand(const std::string& line)
     {
         m_reception.DisplayStatus();
     }
+    else if (line == "stats")
+    {
+        m_reception.DisplayStats();
+    }
     else
     {
         try
         {
+            if (line.size() >= ParallelParser::MIN_PARALLEL_SIZE)
+            {
+                uint64_t pizzas = 0;
+
+                ProcessLargeOrder(line, pizzas);
+                return;
+            }
+
+            Tracer::Scope trace(Tracer::Event::ORDER_PARSE);
             Parser::Orders orders = Parser::ParseOrders(line);
 
+            trace.arg0 = Parser::CountPizzas(orders);
+
             if (!orders.empty())
             {
                 m_reception.ProcessOrders(orders);
@@ -84,10 +176,44 @@ void CLI::ProcessCommand(const std::string& line)
         }
         catch (const ParsingException& e)
         {
-            Logger::Error("CLI", e.what());
+            Logger::Error("CLI", "{}", e.what());
             std::cerr << e.what() << std::endl;
         }
     }
 }
 
+///////////////////////////////////////////////////////////////////////////////
+void CLI::ProcessLargeOrder(
+    std::string_view line,
+    uint64_t& pizzas,
+    size_t backlog
+)
+{
+    uint32_t id = m_reception.OpenOrder();
+    uint64_t dispatched = 0;
+    size_t parts = 0;
+
+    try
+    {
+        m_parser.ParseLine(line, [&](const Parser::Orders& orders) {
+            dispatched += Parser::CountPizzas(orders);
+            parts++;
+            m_reception.DispatchOrder(id, orders, backlog);
+        });
+    }
+    catch (...)
+    {
+        // All or nothing, as a short line: take back what was sent
+        m_reception.CancelOrder(id);
+        throw;
+    }
+
+    Logger::Info(
+        "RECEPTION", "Order {} received: {} pizza(s) in {} part(s)",
+        id, dispatched, parts
+    );
+    pizzas += dispatched;
+    m_reception.CloseOrder(id);
+}
+
 } // !namespace Plazza
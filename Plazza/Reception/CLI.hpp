@@ -7,6 +7,8 @@
 // Dependencies
 ///////////////////////////////////////////////////////////////////////////////
 #include "Reception/Reception.hpp"
+#include "Reception/ParallelParser.hpp"
+#include <cstddef>
 #include <string>
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -26,6 +28,7 @@ private:
     //
     ///////////////////////////////////////////////////////////////////////////
     Reception& m_reception;
+    ParallelParser m_parser;    //<!
 
 public:
     ///////////////////////////////////////////////////////////////////////////
@@ -47,6 +50,19 @@ public:
     ///////////////////////////////////////////////////////////////////////////
     void Run(void);
 
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Feed an order file through the Reception, then wait for it
+    ///
+    /// One order per line; blank lines and lines starting with `#` are
+    /// skipped. Returns once every pizza is cooked and prints a throughput
+    /// summary.
+    ///
+    /// \param path A file, or "-" for standard input
+    /// \param backlog Pizzas allowed to wait for a cook before reading on
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void RunBatch(const std::string& path, size_t backlog);
+
 private:
     ///////////////////////////////////////////////////////////////////////////
     /// \brief
@@ -61,6 +77,23 @@ private:
     ///
     ///////////////////////////////////////////////////////////////////////////
     void ProcessCommand(const std::string& line);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Dispatch a long order line chunk by chunk as it is parsed
+    ///
+    /// On a ParsingException the order is cancelled, so the pizzas of the
+    /// chunks already dispatched are withdrawn from the kitchens.
+    ///
+    /// \param line
+    /// \param pizzas Increased by the pizzas dispatched, if the line parsed
+    /// \param backlog As for Reception::ProcessOrders
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void ProcessLargeOrder(
+        std::string_view line,
+        uint64_t& pizzas,
+        size_t backlog = 0
+    );
 };
 
 } // !namespace Plazza
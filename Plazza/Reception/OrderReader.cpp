@@ -0,0 +1,160 @@
+///////////////////////////////////////////////////////////////////////////////
+// Dependencies
+///////////////////////////////////////////////////////////////////////////////
+#include "Reception/OrderReader.hpp"
+#include "Errors/InvalidArgument.hpp"
+#include "Utils/Timer.hpp"
+#include <cerrno>
+#include <cstring>
+#include <fcntl.h>
+#include <unistd.h>
+
+///////////////////////////////////////////////////////////////////////////////
+// Namespace Plazza
+///////////////////////////////////////////////////////////////////////////////
+namespace Plazza
+{
+
+///////////////////////////////////////////////////////////////////////////////
+OrderReader::OrderReader(const std::string& path)
+    : m_fd(STDIN_FILENO)
+    , m_owned(false)
+    , m_done(false)
+    , m_bytes(0)
+    , m_thread([this]() { ReadRoutine(); })
+{
+    if (path != "-")
+    {
+        m_fd = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+        if (m_fd < 0)
+        {
+            throw InvalidArgument(
+                "Cannot open orders file " + path + ": " + strerror(errno)
+            );
+        }
+        m_owned = true;
+        posix_fadvise(m_fd, 0, 0, POSIX_FADV_SEQUENTIAL);
+    }
+    m_thread.Start();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+OrderReader::~OrderReader()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_thread.running = false;
+    }
+    m_cv.NotifyAll();
+    m_thread.Join();
+
+    if (m_owned)
+    {
+        close(m_fd);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+bool OrderReader::Push(std::string&& chunk)
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+
+    while (m_thread.running && m_chunks.size() >= READ_AHEAD)
+    {
+        m_cv.WaitFor(lock, Milliseconds(100));
+    }
+    if (!m_thread.running)
+    {
+        return (false);
+    }
+    m_chunks.push_back(std::move(chunk));
+    m_cv.NotifyAll();
+    return (true);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void OrderReader::ReadRoutine(void)
+{
+    std::string buffer;
+
+    while (m_thread.running)
+    {
+        size_t used = buffer.size();
+
+        buffer.resize(used + CHUNK_SIZE);
+        ssize_t count = read(m_fd, buffer.data() + used, CHUNK_SIZE);
+        if (count < 0 && errno == EINTR)
+        {
+            buffer.resize(used);
+            continue;
+        }
+        if (count <= 0)
+        {
+            buffer.resize(used);
+            if (count < 0)
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                m_error = strerror(errno);
+            }
+            break;
+        }
+        buffer.resize(used + static_cast<size_t>(count));
+        m_bytes.fetch_add(static_cast<uint64_t>(count));
+
+        // Lines longer than a chunk keep growing the buffer
+        size_t end = buffer.rfind('\n');
+        if (end == std::string::npos)
+        {
+            continue;
+        }
+
+        std::string rest = buffer.substr(end + 1);
+        buffer.resize(end + 1);
+        if (!Push(std::move(buffer)))
+        {
+            return;
+        }
+        buffer = std::move(rest);
+    }
+
+    if (!buffer.empty())
+    {
+        Push(std::move(buffer));
+    }
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_done = true;
+    m_cv.NotifyAll();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+std::optional<std::string> OrderReader::NextChunk(void)
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+
+    while (m_chunks.empty() && !m_done)
+    {
+        m_cv.WaitFor(lock, Milliseconds(100));
+    }
+    if (m_chunks.empty())
+    {
+        if (!m_error.empty())
+        {
+            throw InvalidArgument("Cannot read orders: " + m_error);
+        }
+        return (std::nullopt);
+    }
+
+    std::string chunk = std::move(m_chunks.front());
+    m_chunks.pop_front();
+    m_cv.NotifyAll();
+    return (chunk);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+uint64_t OrderReader::GetBytesRead(void) const
+{
+    return (m_bytes.load());
+}
+
+} // !namespace Plazza
@@ -0,0 +1,111 @@
+///////////////////////////////////////////////////////////////////////////////
+// Header guard
+///////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+///////////////////////////////////////////////////////////////////////////////
+// Dependencies
+///////////////////////////////////////////////////////////////////////////////
+#include "Concurrency/Thread.hpp"
+#include "Concurrency/Mutex.hpp"
+#include "Concurrency/CondVar.hpp"
+#include <atomic>
+#include <cstdint>
+#include <deque>
+#include <optional>
+#include <string>
+
+///////////////////////////////////////////////////////////////////////////////
+// Namespace Plazza
+///////////////////////////////////////////////////////////////////////////////
+namespace Plazza
+{
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Read-ahead over an order file or standard input
+///
+/// A thread reads large blocks and cuts them after their last newline, so
+/// every chunk holds whole lines. At most READ_AHEAD chunks wait to be
+/// taken; past that the thread stops reading until the consumer catches up.
+///
+///////////////////////////////////////////////////////////////////////////////
+class OrderReader
+{
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    //
+    ///////////////////////////////////////////////////////////////////////////
+    static constexpr size_t CHUNK_SIZE = 64 * 1024;
+    static constexpr size_t READ_AHEAD = 16;
+
+private:
+    ///////////////////////////////////////////////////////////////////////////
+    //
+    ///////////////////////////////////////////////////////////////////////////
+    int m_fd;                           //<!
+    bool m_owned;                       //<! False for standard input
+    std::deque<std::string> m_chunks;   //<! Read, not taken yet
+    bool m_done;                        //<! Nothing left to read
+    std::string m_error;                //<! Empty if the read succeeded
+    std::atomic<uint64_t> m_bytes;      //<!
+    Mutex m_mutex;                      //<!
+    CondVar m_cv;                       //<!
+    Thread m_thread;                    //<!
+
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Open the input and start reading ahead
+    ///
+    /// \param path A file, or "-" for standard input
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    explicit OrderReader(const std::string& path);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Stop reading ahead, once a pending read returns
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    ~OrderReader();
+
+    ///////////////////////////////////////////////////////////////////////////
+    //
+    ///////////////////////////////////////////////////////////////////////////
+    OrderReader(const OrderReader&) = delete;
+    OrderReader& operator=(const OrderReader&) = delete;
+
+private:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void ReadRoutine(void);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Queue a chunk, waiting while the read-ahead is full
+    ///
+    /// \param chunk
+    ///
+    /// \return False if the reader is being destroyed
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    bool Push(std::string&& chunk);
+
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Take the next chunk of whole lines, waiting for it if needed
+    ///
+    /// \return Nothing once the input is exhausted
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    std::optional<std::string> NextChunk(void);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    uint64_t GetBytesRead(void) const;
+};
+
+} // !namespace Plazza
@@ -0,0 +1,270 @@
+///////////////////////////////////////////////////////////////////////////////
+// Dependencies
+///////////////////////////////////////////////////////////////////////////////
+#include "Reception/ParallelParser.hpp"
+#include "Errors/ParsingException.hpp"
+#include "Utils/Tracer.hpp"
+#include <algorithm>
+#include <cstring>
+#include <thread>
+
+///////////////////////////////////////////////////////////////////////////////
+// Namespace Plazza
+///////////////////////////////////////////////////////////////////////////////
+namespace Plazza
+{
+
+///////////////////////////////////////////////////////////////////////////////
+// Helpers
+///////////////////////////////////////////////////////////////////////////////
+namespace
+{
+
+bool IsBlank(std::string_view text, size_t offset)
+{
+    return (text.find_first_not_of(" \t\n\r\f\v", offset)
+        == std::string_view::npos);
+}
+
+size_t GetWorkerCount(size_t workers)
+{
+    if (workers > 0)
+    {
+        return (workers);
+    }
+    return (std::clamp<size_t>(std::thread::hardware_concurrency(), 1, 4));
+}
+
+}
+
+///////////////////////////////////////////////////////////////////////////////
+ParallelParser::ParallelParser(size_t workers)
+    : m_pool(GetWorkerCount(workers))
+{}
+
+///////////////////////////////////////////////////////////////////////////////
+void ParallelParser::Run(
+    std::vector<Chunk>& chunks,
+    const std::function<void(Chunk&)>& parse,
+    const std::function<void(Chunk&)>& consume
+)
+{
+    // A lone chunk gains nothing from the pool but a thread hop
+    if (chunks.size() == 1)
+    {
+        parse(chunks.front());
+        consume(chunks.front());
+        return;
+    }
+
+    for (auto& chunk : chunks)
+    {
+        m_pool.Submit([this, &chunk, &parse]() {
+            try
+            {
+                parse(chunk);
+            }
+            catch (...)
+            {
+                chunk.error = std::current_exception();
+            }
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                chunk.done = true;
+            }
+            m_cv.NotifyAll();
+        });
+    }
+
+    for (size_t i = 0; i < chunks.size(); i++)
+    {
+        WaitAll(chunks, i, i + 1);
+        try
+        {
+            if (chunks[i].error)
+            {
+                std::rethrow_exception(chunks[i].error);
+            }
+            consume(chunks[i]);
+        }
+        catch (...)
+        {
+            // The tasks left still point into chunks
+            WaitAll(chunks, i + 1, chunks.size());
+            throw;
+        }
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void ParallelParser::WaitAll(
+    std::vector<Chunk>& chunks,
+    size_t from,
+    size_t to
+)
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+
+    for (size_t i = from; i < to; i++)
+    {
+        m_cv.GetNativeHandle().wait(lock, [&chunks, i]() {
+            return (chunks[i].done);
+        });
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+std::vector<ParallelParser::Chunk> ParallelParser::SplitSegments(
+    std::string_view line
+)
+{
+    std::vector<Chunk> chunks;
+    const char* data = line.data();
+    size_t begin = 0;
+    size_t offset = 0;
+    size_t segments = 0;
+
+    while (const void* hit = std::memchr(
+        data + offset, ';', line.size() - offset))
+    {
+        offset = static_cast<const char*>(hit) - data + 1;
+        if (++segments < SEGMENTS_PER_CHUNK)
+        {
+            continue;
+        }
+        // A blank tail belongs to the segment before it, as a trailing `;`
+        if (IsBlank(line, offset))
+        {
+            break;
+        }
+        chunks.push_back({begin, offset, {}, {}, nullptr, false});
+        begin = offset;
+        segments = 0;
+    }
+
+    chunks.push_back({begin, line.size(), {}, {}, nullptr, false});
+    return (chunks);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+std::vector<ParallelParser::Chunk> ParallelParser::SplitLines(
+    std::string_view text
+)
+{
+    std::vector<Chunk> chunks;
+    const char* data = text.data();
+    size_t begin = 0;
+    size_t offset = 0;
+    size_t lines = 0;
+
+    while (const void* hit = std::memchr(
+        data + offset, '\n', text.size() - offset))
+    {
+        offset = static_cast<const char*>(hit) - data + 1;
+        if (++lines == LINES_PER_CHUNK && offset < text.size())
+        {
+            chunks.push_back({begin, offset, {}, {}, nullptr, false});
+            begin = offset;
+            lines = 0;
+        }
+    }
+
+    if (begin < text.size() || chunks.empty())
+    {
+        chunks.push_back({begin, text.size(), {}, {}, nullptr, false});
+    }
+    return (chunks);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void ParallelParser::ParseLine(
+    std::string_view line,
+    const std::function<void(const Parser::Orders&)>& consume
+)
+{
+    if (IsBlank(line, 0))
+    {
+        return;
+    }
+
+    std::vector<Chunk> chunks = SplitSegments(line);
+    uint64_t total = 0;
+
+    Run(chunks,
+        [line](Chunk& chunk) {
+            Tracer::Scope trace(Tracer::Event::ORDER_PARSE);
+
+            chunk.orders = Parser::ParseRange(line, chunk.begin, chunk.end);
+            trace.arg0 = Parser::CountPizzas(chunk.orders);
+        },
+        [line, &total, &consume](Chunk& chunk) {
+            uint64_t count = Parser::CountPizzas(chunk.orders);
+
+            if (total + count > Parser::MAX_QUANTITY)
+            {
+                // Parse it again knowing what came before, for the column
+                Parser::ParseRange(line, chunk.begin, chunk.end, total);
+            }
+            total += count;
+            consume(chunk.orders);
+        });
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void ParallelParser::ParseLines(
+    std::string_view text,
+    const std::function<void(const ParsedLine&)>& consume
+)
+{
+    std::vector<Chunk> chunks = SplitLines(text);
+
+    Run(chunks,
+        [text](Chunk& chunk) {
+            std::string_view rest = text.substr(
+                chunk.begin, chunk.end - chunk.begin);
+
+            while (!rest.empty())
+            {
+                size_t end = rest.find('\n');
+                ParsedLine line{rest.substr(0, end), {}, "", false, false};
+
+                rest.remove_prefix(end == std::string_view::npos ?
+                    rest.size() : end + 1);
+
+                size_t first = line.text.find_first_not_of(" \t\r");
+                if (first == std::string_view::npos ||
+                    line.text[first] == '#')
+                {
+                    line.skipped = true;
+                }
+                else if (line.text.size() >= MIN_PARALLEL_SIZE)
+                {
+                    line.deferred = true;
+                }
+                else
+                {
+                    try
+                    {
+                        Tracer::Scope trace(Tracer::Event::ORDER_PARSE);
+
+                        line.orders = Parser::ParseOrders(line.text);
+                        trace.arg0 = Parser::CountPizzas(line.orders);
+                    }
+                    catch (const ParsingException& e)
+                    {
+                        line.error = e.what();
+                    }
+                }
+                chunk.lines.push_back(std::move(line));
+            }
+        },
+        [&consume](Chunk& chunk) {
+            for (const auto& line : chunk.lines)
+            {
+                consume(line);
+            }
+            chunk.lines.clear();
+        });
+}
+
+} // !namespace Plazza
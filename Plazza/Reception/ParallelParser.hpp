@@ -0,0 +1,170 @@
+///////////////////////////////////////////////////////////////////////////////
+// Header guard
+///////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+///////////////////////////////////////////////////////////////////////////////
+// Dependencies
+///////////////////////////////////////////////////////////////////////////////
+#include "Reception/Parser.hpp"
+#include "Concurrency/ThreadPool.hpp"
+#include "Concurrency/Mutex.hpp"
+#include "Concurrency/CondVar.hpp"
+#include <exception>
+#include <functional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+// Namespace Plazza
+///////////////////////////////////////////////////////////////////////////////
+namespace Plazza
+{
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Pipelined parsing of large order input on a worker pool
+///
+/// The input is cut into chunks by a plain delimiter scan, every chunk is
+/// parsed on the pool, and results are handed back in input order as soon
+/// as each chunk and those before it are done. Dispatch of a batch, or of a
+/// long order line, can start after its first chunk instead of after the
+/// whole input.
+///
+///////////////////////////////////////////////////////////////////////////////
+class ParallelParser
+{
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    //
+    ///////////////////////////////////////////////////////////////////////////
+    static constexpr size_t SEGMENTS_PER_CHUNK = 512;
+    static constexpr size_t LINES_PER_CHUNK = 256;
+    static constexpr size_t MIN_PARALLEL_SIZE = 16 * 1024;  //<! In bytes
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Outcome of one line of a batch
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    struct ParsedLine
+    {
+        std::string_view text;  //<! Points into the parsed input
+        Parser::Orders orders;  //<!
+        std::string error;      //<! Empty if the line parsed
+        bool skipped;           //<! Blank or comment
+        bool deferred;          //<! Long enough for ParseLine, not parsed
+    };
+
+private:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief A range of the input and what parsing it gave
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    struct Chunk
+    {
+        size_t begin;                   //<!
+        size_t end;                     //<!
+        Parser::Orders orders;          //<! From ParseLine
+        std::vector<ParsedLine> lines;  //<! From ParseLines
+        std::exception_ptr error;       //<!
+        bool done;                      //<!
+    };
+
+private:
+    ///////////////////////////////////////////////////////////////////////////
+    //
+    ///////////////////////////////////////////////////////////////////////////
+    ThreadPool m_pool;      //<!
+    Mutex m_mutex;          //<! Guards Chunk::done
+    CondVar m_cv;           //<!
+
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param workers 0 to use the available cores, up to four
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    explicit ParallelParser(size_t workers = 0);
+
+private:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Parse every chunk on the pool and consume them in order
+    ///
+    /// Returns once every chunk is done, even if consume throws.
+    ///
+    /// \param chunks
+    /// \param parse Fills one chunk, may throw
+    /// \param consume Called on the caller's thread, in order
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void Run(
+        std::vector<Chunk>& chunks,
+        const std::function<void(Chunk&)>& parse,
+        const std::function<void(Chunk&)>& consume
+    );
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Block until every chunk in [from, to) is done
+    ///
+    /// \param chunks
+    /// \param from
+    /// \param to
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void WaitAll(std::vector<Chunk>& chunks, size_t from, size_t to);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param line
+    ///
+    /// \return Ranges of SEGMENTS_PER_CHUNK segments, cut after a `;`
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static std::vector<Chunk> SplitSegments(std::string_view line);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param text
+    ///
+    /// \return Ranges of LINES_PER_CHUNK lines, cut after a newline
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static std::vector<Chunk> SplitLines(std::string_view text);
+
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Parse one order line, its chunks in parallel
+    ///
+    /// Chunks before an invalid segment have already been consumed when its
+    /// ParsingException is thrown; the caller takes them back if the line
+    /// must be all or nothing.
+    ///
+    /// \param line
+    /// \param consume Receives the segments of each chunk, in order
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void ParseLine(
+        std::string_view line,
+        const std::function<void(const Parser::Orders&)>& consume
+    );
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Parse newline-separated orders, one order per line
+    ///
+    /// Blank lines and lines starting with `#` are skipped. Lines of at
+    /// least MIN_PARALLEL_SIZE bytes are deferred to ParseLine.
+    ///
+    /// \param text
+    /// \param consume Receives every line, in order
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void ParseLines(
+        std::string_view text,
+        const std::function<void(const ParsedLine&)>& consume
+    );
+};
+
+} // !namespace Plazza
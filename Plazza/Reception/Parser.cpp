@@ -2,11 +2,8 @@
 // Dependencies
 ///////////////////////////////////////////////////////////////////////////////
 #include "Reception/Parser.hpp"
-#include "Pizza/PizzaFactory.hpp"
+#include "Pizza/Recipe.hpp"
 #include "Errors/ParsingException.hpp"
-#include <sstream>
-#include <stdexcept>
-#include <algorithm>
 
 ///////////////////////////////////////////////////////////////////////////////
 // Namespace Plazza
@@ -15,9 +12,37 @@ namespace Plazza
 {
 
 ///////////////////////////////////////////////////////////////////////////////
-const std::regex Parser::PIZZA_ORDER_EXP{
-    R"(^\s*([a-zA-Z]+)\s+(S|M|L|XL|XXL)\s+(x[1-9][0-9]*)\s*$)"
-};
+// Character classes
+///////////////////////////////////////////////////////////////////////////////
+namespace
+{
+
+bool IsSpace(char c)
+{
+    return (c == ' ' || c == '\t' || c == '\n' ||
+        c == '\r' || c == '\f' || c == '\v');
+}
+
+bool IsLetter(char c)
+{
+    return ((c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z'));
+}
+
+bool IsDigit(char c)
+{
+    return (c >= '0' && c <= '9');
+}
+
+std::string Describe(std::string_view line, size_t offset)
+{
+    if (offset >= line.size())
+    {
+        return ("end of line");
+    }
+    return ("'" + std::string(1, line[offset]) + "'");
+}
+
+}
 
 ///////////////////////////////////////////////////////////////////////////////
 std::string Parser::Trim(const std::string& str)
@@ -34,119 +59,202 @@ std::string Parser::Trim(const std::string& str)
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-IPizza::Size Parser::StringToPizzaSize(const std::string& str)
+std::optional<IPizza::Size> Parser::StringToPizzaSize(std::string_view str)
 {
     if (str == "S") return (IPizza::Size::S);
     if (str == "M") return (IPizza::Size::M);
     if (str == "L") return (IPizza::Size::L);
     if (str == "XL") return (IPizza::Size::XL);
     if (str == "XXL") return (IPizza::Size::XXL);
-    throw ParsingException("Invalid p izza size string: " + str);
+    return (std::nullopt);
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-Parser::Orders Parser::ParseOrders(const std::string& line)
+size_t Parser::SkipSpaces(std::string_view line, size_t offset)
 {
-    Orders orders;
-    std::string trimmedLine = Trim(line);
+    while (offset < line.size() && IsSpace(line[offset]))
+    {
+        offset++;
+    }
+    return (offset);
+}
 
-    if (trimmedLine.empty())
+///////////////////////////////////////////////////////////////////////////////
+size_t Parser::SkipSeparator(
+    std::string_view line,
+    size_t offset,
+    const char* expected
+)
+{
+    if (offset < line.size() && !IsSpace(line[offset]))
     {
-        return (orders);
+        throw ParsingException(
+            "unexpected " + Describe(line, offset) + ", expected " + expected,
+            offset + 1
+        );
+    }
+
+    size_t next = SkipSpaces(line, offset);
+    if (next == line.size() || line[next] == ';')
+    {
+        throw ParsingException(
+            std::string("expected ") + expected + ", got " +
+            Describe(line, next), next + 1
+        );
     }
+    return (next);
+}
 
-    std::stringstream ss(trimmedLine);
-    std::string segment;
+///////////////////////////////////////////////////////////////////////////////
+size_t Parser::ScanSegment(
+    std::string_view line,
+    size_t offset,
+    OrderLine& order
+)
+{
+    size_t i = SkipSpaces(line, offset);
 
-    while (std::getline(ss, segment, ';'))
+    if (i == line.size() || line[i] == ';')
     {
-        std::string trimmedSegment = Trim(segment);
+        throw ParsingException("empty segment in order list", i + 1);
+    }
 
-        if (trimmedSegment.empty())
-        {
-            throw ParsingException(
-                "Invalid order format: empty segment found in order list."
-            );
-        };
+    // TYPE
+    size_t start = i;
+    while (i < line.size() && !IsSpace(line[i]) && line[i] != ';')
+    {
+        i++;
+    }
+    if (!IsLetter(line[start]))
+    {
+        throw ParsingException(
+            "expected a pizza type, got " + Describe(line, start), start + 1
+        );
+    }
+    std::string_view name = line.substr(start, i - start);
+    auto type = RecipeBook::FindType(name);
+    if (!type)
+    {
+        throw ParsingException(
+            "unknown pizza type '" + std::string(name) + "'", start + 1
+        );
+    }
+    order.type = type.value();
 
-        std::smatch match;
-        if (std::regex_match(trimmedSegment, match, PIZZA_ORDER_EXP))
-        {
-            if (match.size() == 4)
-            {
-                std::string typeStr = match[1].str();
-                std::string sizeStr = match[2].str();
-                std::string numStr = match[3].str();
-
-                int quantity;
-                try
-                {
-                    quantity = std::stoi(numStr.substr(1));
-                    if (quantity <= 0)
-                    {
-                        throw ParsingException(
-                            "Invalid quantity: must be a positive integer."
-                        );
-                    }
-                }
-                catch (const std::out_of_range& oor)
-                {
-                    throw ParsingException(
-                        "Invalid quantity: number too large. " +
-                        numStr.substr(1)
-                    );
-                }
-                catch (const std::invalid_argument& ia)
-                {
-                    throw ParsingException(
-                        "Invalid quantity format: " + numStr.substr(1)
-                    );
-                }
-
-                PizzaFactory& factory = PizzaFactory::GetInstance();
-
-                if (!factory.HasFactory(typeStr))
-                {
-                    throw ParsingException(
-                        "Invalid pizza type: unknown type '" + typeStr + "'"
-                    );
-                }
-
-                IPizza::Size pizzaSize = StringToPizzaSize(sizeStr);
-
-                for (int i = 0; i < quantity; i++)
-                {
-                    orders.push_back(std::move(
-                        factory.CreatePizza(typeStr, pizzaSize)
-                    ));
-                }
-            }
-            else
-            {
-                throw ParsingException(
-                    "Internal parser error: regex match " +
-                    ("failed unexpectedly for segment: " + trimmedSegment)
-                );
-            }
-        }
-        else
+    // SIZE
+    i = SkipSeparator(line, i, "a size (S, M, L, XL or XXL)");
+    start = i;
+    while (i < line.size() && IsLetter(line[i]))
+    {
+        i++;
+    }
+    auto size = StringToPizzaSize(line.substr(start, i - start));
+    if (!size)
+    {
+        throw ParsingException(
+            "invalid size '" + std::string(line.substr(start, i - start)) +
+            "', expected S, M, L, XL or XXL", start + 1
+        );
+    }
+    order.size = size.value();
+
+    // xN
+    i = SkipSeparator(line, i, "a quantity such as x2");
+    if (line[i] != 'x')
+    {
+        throw ParsingException(
+            "expected 'x' before the quantity, got " + Describe(line, i),
+            i + 1
+        );
+    }
+    start = ++i;
+    if (i == line.size() || !IsDigit(line[i]) || line[i] == '0')
+    {
+        throw ParsingException(
+            "quantity must be a positive integer", i + 1
+        );
+    }
+
+    uint64_t count = 0;
+    while (i < line.size() && IsDigit(line[i]))
+    {
+        count = count * 10 + static_cast<uint64_t>(line[i] - '0');
+        if (count > MAX_QUANTITY)
         {
-            throw ParsingException(
-                "Invalid order format for segment: '" +
-                trimmedSegment +
-                "'. Expected format: TYPE SIZE xNUMBER"
-            );
+            throw ParsingException("quantity is too large", start + 1);
         }
+        i++;
     }
+    order.count = static_cast<uint32_t>(count);
 
-    if (orders.empty() && !trimmedLine.empty())
+    // ; or end of line
+    i = SkipSpaces(line, i);
+    if (i == line.size())
+    {
+        return (std::string_view::npos);
+    }
+    if (line[i] != ';')
     {
         throw ParsingException(
-            "Invalid order format: No valid orders found in non-empty input."
+            "unexpected " + Describe(line, i) + " after the quantity", i + 1
         );
     }
+    if (SkipSpaces(line, i + 1) == line.size())
+    {
+        return (std::string_view::npos);
+    }
+    return (i + 1);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+Parser::Orders Parser::ParseOrders(std::string_view line)
+{
+    if (SkipSpaces(line, 0) == line.size())
+    {
+        return (Orders());
+    }
+    return (ParseRange(line, 0, line.size()));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+Parser::Orders Parser::ParseRange(
+    std::string_view line,
+    size_t begin,
+    size_t end,
+    uint64_t carried
+)
+{
+    Orders orders;
+    OrderLine order;
+    uint64_t total = carried;
+    size_t offset = begin;
+
+    while (offset != std::string_view::npos && offset < end)
+    {
+        size_t start = SkipSpaces(line, offset);
+
+        offset = ScanSegment(line, offset, order);
+        total += order.count;
+        if (total > MAX_QUANTITY)
+        {
+            throw ParsingException("order is too large", start + 1);
+        }
+        orders.push_back(order);
+    }
 
     return (orders);
 }
 
+///////////////////////////////////////////////////////////////////////////////
+uint64_t Parser::CountPizzas(const Orders& orders)
+{
+    uint64_t total = 0;
+
+    for (const auto& order : orders)
+    {
+        total += order.count;
+    }
+    return (total);
+}
+
 } // !namespace Plazza
@@ -7,10 +7,11 @@
 // Dependencies
 ///////////////////////////////////////////////////////////////////////////////
 #include "Pizza/IPizza.hpp"
-#include <regex>
+#include <cstdint>
+#include <optional>
 #include <vector>
 #include <string>
-#include <memory>
+#include <string_view>
 
 ///////////////////////////////////////////////////////////////////////////////
 // Namespace Plazza
@@ -19,22 +20,37 @@ namespace Plazza
 {
 
 ///////////////////////////////////////////////////////////////////////////////
-/// \brief
+/// \brief Order line parser
+///
+/// A single pass over the line recognizes `TYPE SIZE xN` segments separated
+/// by `;`. Scanning allocates nothing; errors carry the column of the first
+/// character that does not fit. Orders stay run-length: pizzas are only
+/// packed one by one when they are dispatched.
 ///
 ///////////////////////////////////////////////////////////////////////////////
 class Parser
 {
-private:
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief One `TYPE SIZE xN` segment, as run-length
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    struct OrderLine
+    {
+        IPizza::Type type;      //<!
+        IPizza::Size size;      //<!
+        uint32_t count;         //<!
+    };
+
     ///////////////////////////////////////////////////////////////////////////
     //
     ///////////////////////////////////////////////////////////////////////////
-    static const std::regex PIZZA_ORDER_EXP;
+    using Orders = std::vector<OrderLine>;
 
-public:
     ///////////////////////////////////////////////////////////////////////////
     //
     ///////////////////////////////////////////////////////////////////////////
-    using Orders = std::vector<std::unique_ptr<IPizza>>;
+    static constexpr uint32_t MAX_QUANTITY = INT32_MAX;  //<! Per order, too
 
 public:
     ///////////////////////////////////////////////////////////////////////////
@@ -49,10 +65,57 @@ public:
     ///
     /// \param line
     ///
+    /// \return One entry per segment, none for a blank line
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static Orders ParseOrders(std::string_view line);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Parse the segments of a line that start within a range
+    ///
+    /// Errors carry columns of the whole line, so ranges split after `;`
+    /// can be parsed separately.
+    ///
+    /// \param line
+    /// \param begin Start of a segment
+    /// \param end Stop once the next segment starts here or past it
+    /// \param carried Pizzas ordered before begin, counted for MAX_QUANTITY
+    ///
     /// \return
     ///
     ///////////////////////////////////////////////////////////////////////////
-    static Orders ParseOrders(const std::string& line);
+    static Orders ParseRange(
+        std::string_view line,
+        size_t begin,
+        size_t end,
+        uint64_t carried = 0
+    );
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Scan the segment starting at an offset
+    ///
+    /// \param line
+    /// \param offset Start of the segment, just past the previous `;`
+    /// \param order Filled on success
+    ///
+    /// \return Offset of the next segment, or npos after the last one
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static size_t ScanSegment(
+        std::string_view line,
+        size_t offset,
+        OrderLine& order
+    );
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param orders
+    ///
+    /// \return How many pizzas the lines add up to
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static uint64_t CountPizzas(const Orders& orders);
 
     ///////////////////////////////////////////////////////////////////////////
     /// \brief
@@ -65,6 +128,33 @@ public:
     static std::string Trim(const std::string& str);
 
 private:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param line
+    /// \param offset
+    ///
+    /// \return Offset of the first non-whitespace character, or the size
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static size_t SkipSpaces(std::string_view line, size_t offset);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Step over the whitespace between two fields
+    ///
+    /// \param line
+    /// \param offset End of the previous field
+    /// \param expected What the next field is, for errors
+    ///
+    /// \return Offset of the next field
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static size_t SkipSeparator(
+        std::string_view line,
+        size_t offset,
+        const char* expected
+    );
+
     ///////////////////////////////////////////////////////////////////////////
     /// \brief
     ///
@@ -73,7 +163,7 @@ private:
     /// \return
     ///
     ///////////////////////////////////////////////////////////////////////////
-    static IPizza::Size StringToPizzaSize(const std::string& str);
+    static std::optional<IPizza::Size> StringToPizzaSize(std::string_view str);
 };
 
 } // !namespace Plazza
@@ -7,6 +7,14 @@
 #include "IPC/Pipe.hpp"
 #include "Pizza/APizza.hpp"
 #include "Utils/Logger.hpp"
+#include "Utils/Tracer.hpp"
+#include "Errors/InvalidArgument.hpp"
+#include <algorithm>
+#include <bit>
+#include <map>
+#include <set>
+#include <fstream>
+#include <limits>
 #include <math.h>
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -16,21 +24,61 @@ namespace Plazza
 {
 
 ///////////////////////////////////////////////////////////////////////////////
-Reception::Reception(Milliseconds restockTime, size_t CookCount)
+Reception::Reception(
+    Milliseconds restockTime,
+    size_t CookCount,
+    DispatchPolicy policy,
+    size_t poolMin,
+    size_t poolMax,
+    KitchenHandle::IdlePolicy idle,
+    bool respawn,
+    Zygote* zygote
+)
     : m_restockTime(restockTime)
     , m_cookCount(CookCount)
+    , m_policy(policy)
+    , m_zygote(zygote)
+    , m_idle(idle)
+    , m_respawn(respawn)
+    , m_createdCount(0)
+    , m_reusedCount(0)
+    , m_poolMin(poolMin)
+    , m_poolMax(std::max(poolMin, poolMax))
+    , m_poolTarget(poolMin)
+    , m_poolThread(std::bind(&Reception::PoolRoutine, this))
     , m_pipe(std::make_unique<Pipe>(
         KITCHEN_TO_RECEPTION_PIPE,
         Pipe::OpenMode::READ_ONLY
     ))
     , m_manager(std::bind(&Reception::ManagerThread, this))
     , m_shutdown(false)
+    , m_nextOrderId(1)
+    , m_dispatchLatency(Metrics::GetInstance().GetHistogram(
+        "plazza_dispatch_latency_seconds",
+        "Time from order entry to the pizza being sent to its kitchen", 1e-6
+    ))
+    , m_queueWait(Metrics::GetInstance().GetHistogram(
+        "plazza_queue_wait_seconds",
+        "Time a pizza waited in its kitchen before a cook started it", 1e-6
+    ))
+    , m_cookTime(Metrics::GetInstance().GetHistogram(
+        "plazza_cook_seconds",
+        "Time a cook spent cooking a pizza", 1e-6
+    ))
+    , m_orderLatency(Metrics::GetInstance().GetHistogram(
+        "plazza_order_latency_seconds",
+        "Time from order entry to its last pizza being ready", 1e-6
+    ))
 #ifdef PLAZZA_BONUS
     , m_windowThread(std::bind(&Reception::WindowRoutine, this))
 #endif
 {
     m_pipe->Open();
     m_manager.Start();
+    if (m_poolMax > 0 || m_idle.hibernationTtl.count() > 0)
+    {
+        m_poolThread.Start();
+    }
 #ifdef PLAZZA_BONUS
     m_windowThread.Start();
 #endif
@@ -46,6 +94,29 @@ Reception::~Reception()
     {
         m_manager.Join();
     }
+
+    {
+        std::lock_guard<std::mutex> lock(m_poolMutex);
+        m_poolThread.running = false;
+        m_poolCV.NotifyAll();
+    }
+    if (m_poolThread.Joinable())
+    {
+        m_poolThread.Join();
+    }
+
+    // Ask every child to close so the Kitchen destructors can reap them.
+    for (const auto& pooled : m_pool)
+    {
+        m_kitchens.push_back(pooled.kitchen);
+    }
+    m_pool.clear();
+
+    for (const auto& kitchen : m_kitchens)
+    {
+        kitchen->Send(Message::Closed{kitchen->GetID()});
+    }
+    m_kitchens.clear();
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -69,14 +140,149 @@ void Reception::DisplayStatus(void)
         std::cout << "\t\tClosure Time: " << st.timestamp << std::endl;
         std::cout << "\t\tPizza Completion Time : " << st.pizzaTime << std::endl;
     }
+
+    std::lock_guard<std::mutex> poolLock(m_poolMutex);
+    std::cout << "Pool: " << m_pool.size() << " parked, "
+              << m_createdCount << " created, "
+              << m_reusedCount << " reused" << std::endl;
+
+    std::lock_guard<std::mutex> ticketLock(m_ticketMutex);
+    std::cout << "Orders: " << m_orders.size() << " open, "
+              << m_tickets.size() << " pizza(s) not ready" << std::endl;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void Reception::DisplayStats(void)
+{
+    std::cout << "Latency (ms): count p50 p90 p99 p999 max" << std::endl;
+    DisplayHistogram("Dispatch", m_dispatchLatency);
+    DisplayHistogram("Queue wait", m_queueWait);
+    DisplayHistogram("Cook", m_cookTime);
+    DisplayHistogram("Order", m_orderLatency);
+
+    std::lock_guard<std::mutex> lock(m_kitchenMutex);
+    for (const auto& kitchen : m_kitchens)
+    {
+        DisplayHistogram(
+            "Queue wait " + std::to_string(kitchen->GetID()),
+            GetKitchenQueueWait(kitchen->GetID())
+        );
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void Reception::ExportStatus(const Message::Status& status)
+{
+    Metrics& metrics = Metrics::GetInstance();
+    std::string kitchen = std::to_string(status.id);
+    Stock::Quantities stock = Stock::Unpack(status.stock);
+
+    metrics.GetGauge(
+        "plazza_kitchen_queue_depth", "Pizzas waiting for a cook",
+        {{"kitchen", kitchen}}
+    ).Set(static_cast<int64_t>(status.pizzaCount));
+    metrics.GetGauge(
+        "plazza_kitchen_idle_cooks", "Cooks waiting for a pizza",
+        {{"kitchen", kitchen}}
+    ).Set(static_cast<int64_t>(status.idleCount));
+    for (size_t i = 0; i < Stock::INGREDIENT_COUNT; i++)
+    {
+        metrics.GetGauge(
+            "plazza_kitchen_stock", "Ingredients left in a kitchen",
+            {{"kitchen", kitchen}, {"ingredient", INGREDIENT_LABELS[i]}}
+        ).Set(static_cast<int64_t>(stock[i]));
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void Reception::ForgetKitchenMetrics(size_t id, const std::string& reason)
+{
+    Metrics& metrics = Metrics::GetInstance();
+    std::string kitchen = std::to_string(id);
+
+    metrics.Remove("plazza_kitchen_queue_depth", {{"kitchen", kitchen}});
+    metrics.Remove("plazza_kitchen_idle_cooks", {{"kitchen", kitchen}});
+    metrics.Remove("plazza_kitchen_queue_wait_seconds", {{"kitchen", kitchen}});
+    for (size_t i = 0; i < Stock::INGREDIENT_COUNT; i++)
+    {
+        metrics.Remove(
+            "plazza_kitchen_stock",
+            {{"kitchen", kitchen}, {"ingredient", INGREDIENT_LABELS[i]}}
+        );
+    }
+
+    if (!reason.empty())
+    {
+        metrics.GetCounter(
+            "plazza_kitchens_closed_total", "Kitchen processes gone, by reason",
+            {{"reason", reason}}
+        ).Increment();
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void Reception::CountCookedPizza(const Recipe& recipe)
+{
+    static const char* SIZES[] = {"S", "M", "L", "XL", "XXL"};
+    const auto& types = RecipeBook::GetTypeNames();
+    size_t type = static_cast<size_t>(recipe.type);
+    size_t size = std::countr_zero(static_cast<unsigned>(recipe.size));
+
+    if (type >= types.size() || size >= std::size(SIZES))
+    {
+        return;
+    }
+
+    Metrics::GetInstance().GetCounter(
+        "plazza_pizzas_cooked_total", "Pizzas cooked, by type and size",
+        {{"type", types[type]}, {"size", SIZES[size]}}
+    ).Increment();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+Histogram& Reception::GetKitchenQueueWait(size_t id)
+{
+    return (Metrics::GetInstance().GetHistogram(
+        "plazza_kitchen_queue_wait_seconds",
+        "Time a pizza waited in a given kitchen before a cook started it",
+        1e-6, {{"kitchen", std::to_string(id)}}
+    ));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void Reception::DisplayHistogram(
+    const std::string& name,
+    const Histogram& histogram
+)
+{
+    Histogram::Snapshot snapshot = histogram.Read();
+    auto ms = [](uint64_t us) {
+        return (std::to_string(us / 1000) + "." +
+            std::to_string(us % 1000 / 100));
+    };
+
+    std::cout << "\t" << name << ": " << snapshot.count
+              << " " << ms(snapshot.ValueAt(50.0))
+              << " " << ms(snapshot.ValueAt(90.0))
+              << " " << ms(snapshot.ValueAt(99.0))
+              << " " << ms(snapshot.ValueAt(99.9))
+              << " " << ms(snapshot.max) << std::endl;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+uint64_t Reception::ToMicroseconds(TimePoint::duration duration)
+{
+    auto us = std::chrono::duration_cast<std::chrono::microseconds>(duration);
+
+    return (static_cast<uint64_t>(std::max<int64_t>(0, us.count())));
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-std::optional<std::shared_ptr<Kitchen>> Reception::GetKitchenByID(size_t id)
+std::optional<std::shared_ptr<KitchenHandle>> Reception::GetKitchenByID(size_t id)
 {
     std::lock_guard<std::mutex> lock(m_kitchenMutex);
     auto it = std::find_if(m_kitchens.begin(), m_kitchens.end(),
-        [id](const std::shared_ptr<Kitchen>& kitchen) {
+        [id](const std::shared_ptr<KitchenHandle>& kitchen) {
             return (kitchen->GetID() == id);
         });
 
@@ -90,197 +296,1085 @@ std::optional<std::shared_ptr<Kitchen>> Reception::GetKitchenByID(size_t id)
 ///////////////////////////////////////////////////////////////////////////////
 void Reception::CreateKitchen(void)
 {
+    std::shared_ptr<KitchenHandle> pooled;
+
+    {
+        std::lock_guard<std::mutex> lock(m_poolMutex);
+
+        if (!m_pool.empty())
+        {
+            pooled = m_pool.back().kitchen;
+            if (m_pool.back().hibernated)
+            {
+                m_reusedCount++;
+            }
+            m_pool.pop_back();
+        }
+        else if (m_poolTarget < m_poolMax)
+        {
+            // The burst outgrew the pool: keep one more kitchen warm.
+            m_poolTarget++;
+        }
+        m_poolCV.NotifyOne();
+    }
+
     std::lock_guard<std::mutex> lock(m_kitchenMutex);
-    m_kitchens.push_back(std::make_shared<Kitchen>(
-        m_cookCount, 1.0, m_restockTime
+
+    if (pooled)
+    {
+        pooled->Send(Message::Activate{pooled->GetID()});
+        m_kitchens.push_back(pooled);
+        Logger::Info(
+            "KITCHEN", "Kitchen activated from pool: {}", pooled->GetID()
+        );
+        return;
+    }
+
+    m_kitchens.push_back(std::make_shared<KitchenHandle>(
+        m_cookCount, 1.0, m_restockTime, true, m_idle, m_zygote
     ));
+    m_createdCount++;
+    Metrics::GetInstance().GetCounter(
+        "plazza_kitchens_created_total", "Kitchen processes forked"
+    ).Increment();
 
     Logger::Info(
-        "KITCHEN",
-        "New kitchen created: " + std::to_string(m_kitchens.back()->GetID())
+        "KITCHEN", "New kitchen created: {} (pid {})",
+        m_kitchens.back()->GetID(), m_kitchens.back()->GetKitchenPid()
     );
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-void Reception::RemoveKitchen(size_t id)
+void Reception::PoolRoutine(void)
 {
-    std::lock_guard<std::mutex> lock(m_kitchenMutex);
-    m_kitchens.erase(std::remove_if(m_kitchens.begin(), m_kitchens.end(),
-        [id](const std::shared_ptr<Kitchen>& kitchen) {
-            return (kitchen->GetID() == id);
-        }),
-        m_kitchens.end()
-    );
-    Logger::Info(
-        "KITCHEN",
-        "Kitchen closed: " + std::to_string(id)
-    );
-}
+    std::unique_lock<std::mutex> lock(m_poolMutex);
+    std::vector<std::shared_ptr<KitchenHandle>> expired;
+    bool memoryLow = false;
+    TimePoint memoryCheckedAt;
 
-///////////////////////////////////////////////////////////////////////////////
-void Reception::ManagerThread(void)
-{
-    while (m_manager.running && !m_shutdown)
+    while (m_poolThread.running)
     {
-        while (const auto& message = m_pipe->PollMessage())
+        TimePoint now = SteadyClock::Now();
+        bool reclaimable = m_pool.size() > m_poolMin && std::any_of(
+            m_pool.begin(), m_pool.end(), [](const PooledKitchen& pooled) {
+                return (pooled.hibernated);
+            });
+
+        // Only worth reading while a hibernated kitchen could go
+        if (!reclaimable)
         {
-            if (const auto& status = message->GetIf<Message::Status>())
-            {
-                std::lock_guard<std::mutex> lock(m_kitchenMutex);
-                auto it = std::find_if(m_kitchens.begin(), m_kitchens.end(),
-                [target_id = status->id](const std::shared_ptr<Kitchen>& k_ptr)
-                {
-                    return (k_ptr->GetID() == target_id);
-                });
-                if (it != m_kitchens.end())
-                {
-                    (*it)->status = *status;
-                }
-            }
-            else if (const auto& cooked = message->GetIf<Message::CookedPizza>())
-            {
-                if (auto pizza = APizza::Unpack(cooked->pizza))
-                {
-                    std::string msg = pizza.value()->ToString();
+            memoryLow = false;
+            memoryCheckedAt = TimePoint();
+        }
+        else if (memoryCheckedAt == TimePoint() ||
+            SteadyClock::Elapsed(memoryCheckedAt, now) >= MEMORY_CHECK_INTERVAL)
+        {
+            memoryLow = IsMemoryLow();
+            memoryCheckedAt = now;
+        }
 
-                    msg = (msg[0] == 'E' ? "An " : "A ") + msg + " is ready!";
+        for (auto it = m_pool.begin(); it != m_pool.end();)
+        {
+            bool stale = memoryLow || SteadyClock::Elapsed(it->parkedAt, now)
+                >= m_idle.hibernationTtl;
 
-                    Logger::Info(
-                        "RECEPTION",
-                        msg + " Cooked by " + std::to_string(cooked->id)
-                    );
-                }
+            if (it->hibernated && stale && m_pool.size() > m_poolMin)
+            {
+                expired.push_back(it->kitchen);
+                it = m_pool.erase(it);
+                m_poolTarget = std::min(
+                    m_poolTarget, std::max(m_poolMin, m_pool.size())
+                );
+                continue;
             }
-            else if (const auto& closed = message->GetIf<Message::Closed>())
+            ++it;
+        }
+
+        if (!expired.empty())
+        {
+            lock.unlock();
+            for (const auto& kitchen : expired)
             {
-                if (auto kitchen = GetKitchenByID(closed->id))
-                {
-                    kitchen.value()->pipe->SendMessage(
-                        Message::Closed{closed->id}
-                    );
-                    RemoveKitchen(closed->id);
-                }
+                std::vector<Message::Order> orders =
+                    GetTickets(kitchen->GetID());
+
+                kitchen->Send(Message::Closed{kitchen->GetID()});
+                ForgetKitchenMetrics(kitchen->GetID(), "expired");
+                Logger::Info(
+                    "KITCHEN", "Hibernated kitchen closed: {}, {} pizza(s) "
+                    "to dispatch again", kitchen->GetID(), orders.size()
+                );
+                Dispatch(orders, kitchen->GetID());
             }
+            expired.clear();
+            lock.lock();
         }
 
-        std::this_thread::sleep_for(Milliseconds(10));
+        if (m_pool.size() >= m_poolTarget)
+        {
+            m_poolCV.WaitFor(lock, Milliseconds(100));
+            continue;
+        }
+
+        lock.unlock();
+        auto kitchen = std::make_shared<KitchenHandle>(
+            m_cookCount, 1.0, m_restockTime, false, m_idle, m_zygote
+        );
+        m_createdCount++;
+        Metrics::GetInstance().GetCounter(
+            "plazza_kitchens_created_total", "Kitchen processes forked"
+        ).Increment();
+        lock.lock();
+
+        m_pool.push_back({kitchen, SteadyClock::Now(), false});
+        Logger::Debug(
+            "KITCHEN", "Kitchen forked into pool: {}", kitchen->GetID()
+        );
     }
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-void Reception::ProcessOrders(const Parser::Orders& orders)
+void Reception::ParkKitchen(size_t id)
 {
-    if (orders.empty())
-    {
-        return;
-    }
+    // Hold off dispatch so no order races the kitchen into the pool.
+    std::lock_guard<std::mutex> dispatchLock(m_dispatchMutex);
+    std::shared_ptr<KitchenHandle> kitchen;
+    // Its status predates the orders still in flight, its tickets do not
+    bool hasWork = !GetTickets(id).empty();
 
-    bool needsInitialKitchen = false;
     {
         std::lock_guard<std::mutex> lock(m_kitchenMutex);
-        if (m_kitchens.empty())
+        auto it = std::find_if(m_kitchens.begin(), m_kitchens.end(),
+            [id](const std::shared_ptr<KitchenHandle>& k_ptr) {
+                return (k_ptr->GetID() == id);
+            });
+
+        if (it == m_kitchens.end())
         {
-            needsInitialKitchen = true;
+            return;
+        }
+
+        if (hasWork)
+        {
+            // Work was sent after it fell asleep: keep it in service.
+            (*it)->Send(Message::Activate{id});
+            return;
         }
+
+        kitchen = *it;
+        m_kitchens.erase(it);
     }
-    if (needsInitialKitchen)
+
+    std::lock_guard<std::mutex> lock(m_poolMutex);
+    m_pool.push_back({kitchen, SteadyClock::Now(), true});
+    ForgetKitchenMetrics(id, "");
+    Logger::Info("KITCHEN", "Kitchen hibernated: {}", id);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+std::vector<Message::Order> Reception::GetTickets(size_t id)
+{
+    std::lock_guard<std::mutex> lock(m_ticketMutex);
+    std::vector<Message::Order> orders;
+
+    for (const auto& [key, ticket] : m_tickets)
     {
-        CreateKitchen();
+        if (ticket.kitchen == id)
+        {
+            orders.push_back({id, ticket.pizza, key.second});
+        }
     }
+    return (orders);
+}
 
-    std::vector<Message::Status> allStatus;
+///////////////////////////////////////////////////////////////////////////////
+void Reception::CompleteTicket(const Message::CookedPizza& cooked)
+{
+    TimePoint now = SteadyClock::Now();
+    TimePoint startedAt = SteadyClock::FromNs(cooked.startedAt);
+    TimePoint doneAt = SteadyClock::FromNs(cooked.doneAt);
+    std::optional<OrderProgress> finished;
+    Ticket ticket;
 
     {
-        std::lock_guard<std::mutex> lock(m_kitchenMutex);
-        for (const auto& kitchen : m_kitchens)
+        std::lock_guard<std::mutex> lock(m_ticketMutex);
+        auto it = m_tickets.find({cooked.pizza.GetOrder(), cooked.sequence});
+        if (it == m_tickets.end())
         {
-            allStatus.push_back(kitchen->status);
+            return;
         }
+        ticket = it->second;
+        m_tickets.erase(it);
+        m_ticketCV.NotifyAll();
+
+        auto order = m_orders.find(cooked.pizza.GetOrder());
+        if (order != m_orders.end() && --order->second.remaining == 0)
+        {
+            finished = order->second;
+            m_orders.erase(order);
+        }
+    }
+
+    // Only the first report counts: a pizza sent again after its kitchen
+    // closed may have been cooked there too.
+    if (const Recipe* recipe = RecipeBook::Unpack(cooked.pizza))
+    {
+        bool extra = recipe->size == IPizza::Size::XL ||
+            recipe->size == IPizza::Size::XXL;
+
+        Logger::Info(
+            "RECEPTION", "{} {} is ready! Cooked by {}",
+            extra ? "An" : "A", recipe, cooked.id
+        );
+        CountCookedPizza(*recipe);
+    }
+
+    m_dispatchLatency.Record(ToMicroseconds(
+        ticket.dispatched - ticket.enqueued));
+    m_queueWait.Record(ToMicroseconds(startedAt - ticket.dispatched));
+    m_cookTime.Record(ToMicroseconds(doneAt - startedAt));
+    if (GetKitchenByID(ticket.kitchen))
+    {
+        GetKitchenQueueWait(ticket.kitchen).Record(
+            ToMicroseconds(startedAt - ticket.dispatched));
     }
 
-    for (const auto& pizza : orders)
+    Logger::Debug(
+        "RECEPTION",
+        "Order {}#{}: dispatched after {}ms, waited {}ms, cooked in {}ms, "
+        "delivered after {}ms",
+        cooked.pizza.GetOrder(), cooked.sequence,
+        SteadyClock::DurationToMs(ticket.dispatched - ticket.enqueued),
+        SteadyClock::DurationToMs(startedAt - ticket.dispatched),
+        SteadyClock::DurationToMs(doneAt - startedAt),
+        SteadyClock::DurationToMs(now - ticket.enqueued)
+    );
+
+    if (finished)
     {
-        bool needNewKitchen = true;
+        FinishOrder(cooked.pizza.GetOrder(), finished.value());
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+std::vector<std::pair<size_t, bool>> Reception::ReapKitchens(void)
+{
+    std::vector<std::pair<size_t, bool>> dead;
+    bool crashed = false;
 
-        std::sort(allStatus.begin(), allStatus.end(),
-        [&](const Message::Status& st1, const Message::Status& st2)
+    {
+        std::lock_guard<std::mutex> lock(m_kitchenMutex);
+        for (const auto& kitchen : m_kitchens)
         {
-            if (st1.idleCount != st2.idleCount)
+            if (kitchen->HasDied(crashed))
             {
-                return (st1.idleCount > st2.idleCount);
+                dead.push_back({kitchen->GetID(), crashed});
             }
+        }
+    }
 
-            if (st1.pizzaCount != st2.pizzaCount)
-            {
-                return (st1.pizzaCount > st2.pizzaCount);
-            }
+    std::lock_guard<std::mutex> lock(m_poolMutex);
+    for (const auto& pooled : m_pool)
+    {
+        if (pooled.kitchen->HasDied(crashed))
+        {
+            dead.push_back({pooled.kitchen->GetID(), crashed});
+        }
+    }
+    return (dead);
+}
 
-            if (st1.pizzaTime != st2.pizzaTime)
-            {
-                return (st1.pizzaTime < st2.pizzaTime);
-            }
+///////////////////////////////////////////////////////////////////////////////
+std::vector<Message::Order> Reception::LoseKitchen(size_t id, bool crashed)
+{
+    std::lock_guard<std::mutex> dispatchLock(m_dispatchMutex);
+    std::shared_ptr<KitchenHandle> lost;
+    bool wasActive = false;
 
-            return (st1.id < st2.id);
-        });
+    {
+        std::lock_guard<std::mutex> lock(m_kitchenMutex);
+        auto it = std::find_if(m_kitchens.begin(), m_kitchens.end(),
+            [id](const std::shared_ptr<KitchenHandle>& kitchen) {
+                return (kitchen->GetID() == id);
+            });
 
-        for (auto& st : allStatus)
+        if (it != m_kitchens.end())
         {
-            size_t total = m_cookCount - st.idleCount + st.pizzaCount;
+            lost = *it;
+            wasActive = true;
+            m_kitchens.erase(it);
+        }
+    }
 
-            if (total < static_cast<size_t>(2.0 * m_cookCount))
-            {
-                if (auto kitchen = GetKitchenByID(st.id))
-                {
-                    std::lock_guard<std::mutex> lock(m_kitchenMutex);
-                    kitchen.value()->pipe->SendMessage(Message::Order{
-                        st.id, pizza->Pack()
-                    });
-                }
+    if (!lost)
+    {
+        std::lock_guard<std::mutex> lock(m_poolMutex);
+        auto it = std::find_if(m_pool.begin(), m_pool.end(),
+            [id](const PooledKitchen& pooled) {
+                return (pooled.kitchen->GetID() == id);
+            });
 
-                if (st.idleCount > 0)
-                {
-                    st.idleCount--;
-                }
-                else
-                {
-                    st.pizzaCount++;
-                }
-                needNewKitchen = false;
-                Logger::Debug(
-                    "RECEPTION",
-                    pizza->ToString() + " dispatched to kitchen " +
-                    std::to_string(st.id)
-                );
-                break;
-            }
+        if (it != m_pool.end())
+        {
+            lost = it->kitchen;
+            m_pool.erase(it);
+            m_poolCV.NotifyOne();
         }
+    }
+
+    // Kitchens we closed ourselves are already forgotten by now.
+    if (!lost)
+    {
+        return (std::vector<Message::Order>());
+    }
+
+    std::vector<Message::Order> orders = GetTickets(id);
+
+    ForgetKitchenMetrics(id, crashed ? "crashed" : "exited");
+    Logger::Warning(
+        "KITCHEN", "Kitchen {} {}, {} pizza(s) to dispatch again",
+        id, crashed ? "crashed" : "exited unexpectedly", orders.size()
+    );
 
-        if (needNewKitchen)
+    // The lost pizzas go to the surviving kitchens even without a respawn
+    if (m_respawn && wasActive)
+    {
+        try
         {
             CreateKitchen();
+        }
+        catch (const std::exception& e)
+        {
+            Logger::Error(
+                "KITCHEN", "Could not respawn kitchen {}: {}", id, e.what()
+            );
+        }
+    }
 
-            {
-                std::lock_guard<std::mutex> lock(m_kitchenMutex);
-                allStatus.push_back(m_kitchens.back()->status);
-                m_kitchens.back()->pipe->SendMessage(Message::Order{
-                    m_kitchens.back()->GetID(), pizza->Pack()
-                });
-            }
+    return (orders);
+}
 
-            if (allStatus.back().idleCount > 0)
-            {
-                allStatus.back().idleCount--;
-            }
-            else
-            {
-                allStatus.back().pizzaCount++;
-            }
+///////////////////////////////////////////////////////////////////////////////
+bool Reception::IsMemoryLow(void)
+{
+    std::ifstream meminfo("/proc/meminfo");
+    std::string key;
+    long long value = 0;
+    long long total = 0;
+    long long available = -1;
 
-            Logger::Debug(
-                "RECEPTION",
-                pizza->ToString() + " dispatched to kitchen "
-                + std::to_string(allStatus.back().id)
-            );
+    while (meminfo >> key >> value)
+    {
+        if (key == "MemTotal:")
+        {
+            total = value;
+        }
+        else if (key == "MemAvailable:")
+        {
+            available = value;
+        }
+        meminfo.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+    }
+
+    return (available >= 0 && available * 10 < total);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+std::vector<Message::Order> Reception::RemoveKitchen(size_t id)
+{
+    // Hold off dispatch so no pizza is sent to it after its tickets are read.
+    std::lock_guard<std::mutex> dispatchLock(m_dispatchMutex);
+
+    {
+        std::lock_guard<std::mutex> lock(m_poolMutex);
+        if (m_poolTarget > m_poolMin)
+        {
+            m_poolTarget--;
+        }
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(m_kitchenMutex);
+        m_kitchens.erase(std::remove_if(m_kitchens.begin(), m_kitchens.end(),
+            [id](const std::shared_ptr<KitchenHandle>& kitchen) {
+                return (kitchen->GetID() == id);
+            }),
+            m_kitchens.end()
+        );
+    }
+
+    // Orders may have crossed its Closed message; it drops them on exit.
+    std::vector<Message::Order> orders = GetTickets(id);
+
+    ForgetKitchenMetrics(id, "idle");
+    Logger::Info(
+        "KITCHEN", "Kitchen closed: {}, {} pizza(s) to dispatch again",
+        id, orders.size()
+    );
+    return (orders);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+Stock::Quantities Reception::GetAvailableStock(const Message::Status& status)
+{
+    Stock::Quantities stock = Stock::Unpack(status.stock);
+
+    stock -= Stock::Unpack(status.committed);
+    return (stock);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void Reception::ManagerThread(void)
+{
+    std::map<size_t, std::vector<Message::Order>> redispatch;
+    std::map<std::pair<size_t, size_t>, std::vector<Message::Order>> stolen;
+    std::map<size_t, std::vector<Message::Order>> pending;
+    TimePoint retryAt;
+
+    while (m_manager.running && !m_shutdown)
+    {
+        while (const auto& message = m_pipe->PollMessage())
+        {
+            if (const auto& status = message->GetIf<Message::Status>())
+            {
+                std::lock_guard<std::mutex> lock(m_kitchenMutex);
+                auto it = std::find_if(m_kitchens.begin(), m_kitchens.end(),
+                [target_id = status->id](const std::shared_ptr<KitchenHandle>& k_ptr)
+                {
+                    return (k_ptr->GetID() == target_id);
+                });
+                if (it != m_kitchens.end())
+                {
+                    (*it)->status = *status;
+                    ExportStatus(*status);
+                }
+            }
+            else if (const auto& cooked = message->GetIf<Message::CookedPizza>())
+            {
+                CompleteTicket(*cooked);
+            }
+            else if (const auto& closed = message->GetIf<Message::Closed>())
+            {
+                if (auto kitchen = GetKitchenByID(closed->id))
+                {
+                    kitchen.value()->Send(Message::Closed{closed->id});
+                    for (const auto& order : RemoveKitchen(closed->id))
+                    {
+                        redispatch[closed->id].push_back(order);
+                    }
+                }
+            }
+            else if (const auto& hibernated = message->GetIf<Message::Hibernated>())
+            {
+                ParkKitchen(hibernated->id);
+            }
+            else if (const auto& died = message->GetIf<Message::Died>())
+            {
+                for (const auto& order : LoseKitchen(died->id, died->crashed))
+                {
+                    redispatch[died->id].push_back(order);
+                }
+            }
+            else if (const auto& taken = message->GetIf<Message::Stolen>())
+            {
+                if (const Recipe* recipe = RecipeBook::Unpack(taken->pizza))
+                {
+                    Logger::Debug(
+                        "RECEPTION", "{} stolen from kitchen {}",
+                        recipe, taken->id
+                    );
+                    stolen[{taken->thief, taken->id}].push_back({
+                        taken->id, taken->pizza, taken->sequence
+                    });
+                }
+            }
+        }
+
+        // Without a zygote, no Died message comes: reap them here
+        if (!m_zygote)
+        {
+            for (const auto& [id, crashed] : ReapKitchens())
+            {
+                for (const auto& order : LoseKitchen(id, crashed))
+                {
+                    redispatch[id].push_back(order);
+                }
+            }
+        }
+
+        // What no kitchen could take is tried again a while later
+        if (!pending.empty() && SteadyClock::Now() >= retryAt)
+        {
+            for (const auto& [id, orders] : pending)
+            {
+                auto& queue = redispatch[id];
+                queue.insert(queue.end(), orders.begin(), orders.end());
+            }
+            pending.clear();
+        }
+        for (const auto& [id, orders] : redispatch)
+        {
+            for (const auto& order : Redispatch(orders, id))
+            {
+                pending[id].push_back(order);
+            }
+        }
+        for (const auto& [kitchens, orders] : stolen)
+        {
+            auto left = Redispatch(orders, kitchens.second, kitchens.first);
+
+            for (const auto& order : left)
+            {
+                pending[kitchens.second].push_back(order);
+            }
+        }
+        if (!pending.empty() && SteadyClock::Now() >= retryAt)
+        {
+            retryAt = SteadyClock::Now() + REDISPATCH_RETRY;
+        }
+        redispatch.clear();
+        stolen.clear();
+        BalanceKitchens();
+
+        std::this_thread::sleep_for(Milliseconds(10));
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+std::vector<Message::Order> Reception::Redispatch(
+    const std::vector<Message::Order>& orders,
+    size_t from,
+    std::optional<size_t> preferred
+)
+{
+    std::vector<Message::Order> left;
+
+    try
+    {
+        Dispatch(orders, from, preferred);
+    }
+    catch (const std::exception& e)
+    {
+        std::lock_guard<std::mutex> lock(m_ticketMutex);
+
+        // Pizzas sent before the failure have moved their ticket on
+        for (const auto& order : orders)
+        {
+            auto it = m_tickets.find({order.pizza.GetOrder(), order.sequence});
+
+            if (it != m_tickets.end() && it->second.kitchen == from)
+            {
+                left.push_back(order);
+            }
+        }
+        Logger::Error(
+            "RECEPTION", "{} pizza(s) of kitchen {} left to dispatch: {}",
+            left.size(), from, e.what()
+        );
+    }
+    return (left);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+Reception::DispatchPolicy Reception::ParseDispatchPolicy(
+    const std::string& name
+)
+{
+    if (name == "greedy") return (DispatchPolicy::GREEDY);
+    if (name == "earliest") return (DispatchPolicy::EARLIEST_FINISH);
+    throw InvalidArgument("Unknown dispatch policy: " + name);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+bool Reception::HasCapacity(const Message::Status& status) const
+{
+    size_t total = m_cookCount - status.idleCount + status.pizzaCount;
+
+    return (total < static_cast<size_t>(2.0 * m_cookCount));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int64_t Reception::EstimateCompletion(
+    const Message::Status& status,
+    const Stock::Quantities& available,
+    const Recipe& recipe
+) const
+{
+    int64_t start = 0;
+
+    if (status.idleCount == 0)
+    {
+        start = status.pizzaTime / static_cast<int64_t>(m_cookCount);
+    }
+
+    int32_t missing = available.GetShortfall(recipe.needs);
+    int64_t restock = static_cast<int64_t>(missing) * m_restockTime.count();
+
+    return (std::max(start, restock) + recipe.GetCookingTime().count());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+Message::Status* Reception::SelectGreedy(
+    std::vector<Message::Status>& allStatus,
+    StockMap& available,
+    const Recipe& recipe
+)
+{
+    std::sort(allStatus.begin(), allStatus.end(),
+    [&](const Message::Status& st1, const Message::Status& st2)
+    {
+        bool ready1 = available[st1.id].Covers(recipe.needs);
+        bool ready2 = available[st2.id].Covers(recipe.needs);
+
+        if (ready1 != ready2)
+        {
+            return (ready1);
+        }
+
+        if (st1.idleCount != st2.idleCount)
+        {
+            return (st1.idleCount > st2.idleCount);
+        }
+
+        if (st1.pizzaCount != st2.pizzaCount)
+        {
+            return (st1.pizzaCount > st2.pizzaCount);
+        }
+
+        if (st1.pizzaTime != st2.pizzaTime)
+        {
+            return (st1.pizzaTime < st2.pizzaTime);
+        }
+
+        return (st1.id < st2.id);
+    });
+
+    for (auto& st : allStatus)
+    {
+        if (HasCapacity(st))
+        {
+            return (&st);
+        }
+    }
+    return (nullptr);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+Message::Status* Reception::SelectEarliestFinish(
+    std::vector<Message::Status>& allStatus,
+    StockMap& available,
+    const Recipe& recipe
+)
+{
+    Message::Status* best = nullptr;
+    int64_t bestFinish = 0;
+
+    for (auto& st : allStatus)
+    {
+        if (!HasCapacity(st))
+        {
+            continue;
+        }
+
+        int64_t finish = EstimateCompletion(st, available[st.id], recipe);
+
+        if (!best || finish < bestFinish ||
+            (finish == bestFinish && st.id < best->id))
+        {
+            best = &st;
+            bestFinish = finish;
+        }
+    }
+    return (best);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void Reception::BalanceKitchens(void)
+{
+    std::lock_guard<std::mutex> lock(m_kitchenMutex);
+    int64_t cooks = static_cast<int64_t>(m_cookCount);
+    auto finish = [cooks](const Message::Status& st) {
+        return (st.pizzaTime / cooks);
+    };
+
+    for (auto& thief : m_kitchens)
+    {
+        Message::Status& idle = thief->status;
+
+        if (idle.pizzaCount > 0 || idle.idleCount == 0)
+        {
+            continue;
+        }
+
+        KitchenHandle* victim = nullptr;
+        for (auto& kitchen : m_kitchens)
+        {
+            const Message::Status& st = kitchen->status;
+
+            if (st.pizzaCount > 0 &&
+                (!victim || finish(st) > finish(victim->status)))
+            {
+                victim = kitchen.get();
+            }
+        }
+        if (!victim)
+        {
+            break;
+        }
+
+        // A queued pizza only moves if it would be done at least one
+        // cooking time sooner in the idle kitchen.
+        Message::Status& busy = victim->status;
+        size_t load = m_cookCount - busy.idleCount + busy.pizzaCount;
+        int64_t cookingTime = busy.pizzaTime / static_cast<int64_t>(load);
+        int64_t gap = finish(busy) - finish(idle);
+
+        if (cookingTime <= 0 || gap < cookingTime)
+        {
+            continue;
+        }
+
+        // Half the gap evens both out, but no more than idle cooks can take
+        size_t count = std::clamp<size_t>(
+            static_cast<size_t>(gap * cooks / (2 * cookingTime)),
+            1, std::min(busy.pizzaCount, idle.idleCount)
+        );
+        int64_t moved = static_cast<int64_t>(count) * cookingTime;
+
+        victim->Send(Message::Steal{busy.id, count, idle.id});
+        Logger::Debug(
+            "RECEPTION", "Stealing {} pizza(s) from kitchen {} for kitchen {}",
+            count, busy.id, idle.id
+        );
+
+        // As if already moved, until the kitchens' next status
+        busy.pizzaCount -= count;
+        busy.pizzaTime -= moved;
+        idle.idleCount -= count;
+        idle.pizzaTime += moved;
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+uint32_t Reception::OpenOrder(void)
+{
+    std::lock_guard<std::mutex> lock(m_ticketMutex);
+    uint32_t id = m_nextOrderId++;
+
+    // The extra pizza stands for the parts not dispatched yet, so the
+    // order cannot be reported ready before CloseOrder.
+    m_orders[id] = {SteadyClock::Now(), 0, 1};
+    return (id);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void Reception::DispatchOrder(
+    uint32_t id,
+    const Parser::Orders& orders,
+    size_t backlog
+)
+{
+    uint64_t total = Parser::CountPizzas(orders);
+    TimePoint enqueued;
+    uint32_t sequence = 0;
+
+    if (total == 0)
+    {
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(m_ticketMutex);
+        auto order = m_orders.find(id);
+        if (order == m_orders.end())
+        {
+            return;
+        }
+        enqueued = order->second.enqueued;
+        sequence = static_cast<uint32_t>(order->second.size);
+        order->second.size += total;
+        order->second.remaining += total;
+    }
+
+    std::unique_lock<std::mutex> dispatchLock(m_dispatchMutex);
+    DispatchView view = SnapshotKitchens(std::nullopt);
+
+    for (const auto& line : orders)
+    {
+        const Recipe* recipe = RecipeBook::Find(line.type, line.size);
+        if (!recipe)
+        {
+            continue;
+        }
+        PackedPizza packed = recipe->Pack(id);
+
+        for (uint32_t i = 0; i < line.count; i++, sequence++)
+        {
+            bool full = false;
+            {
+                std::lock_guard<std::mutex> lock(m_ticketMutex);
+                full = backlog > 0 && m_tickets.size() >= backlog;
+            }
+            if (full)
+            {
+                // Let redispatches through; kitchens report new status
+                // while we wait, so the view is taken again after.
+                dispatchLock.unlock();
+                WaitForBacklog(backlog - 1);
+                dispatchLock.lock();
+                view = SnapshotKitchens(std::nullopt);
+            }
+
+            {
+                std::lock_guard<std::mutex> lock(m_ticketMutex);
+                m_tickets[{id, sequence}] = {packed, 0, enqueued, enqueued};
+            }
+            DispatchPizza(view, {0, packed, sequence}, *recipe);
+        }
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void Reception::CloseOrder(uint32_t id)
+{
+    std::optional<OrderProgress> finished;
+
+    {
+        std::lock_guard<std::mutex> lock(m_ticketMutex);
+        auto order = m_orders.find(id);
+        if (order == m_orders.end() || --order->second.remaining > 0)
+        {
+            return;
+        }
+        finished = order->second;
+        m_orders.erase(order);
+    }
+
+    if (finished->size > 0)
+    {
+        FinishOrder(id, finished.value());
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void Reception::CancelOrder(uint32_t id)
+{
+    std::lock_guard<std::mutex> dispatchLock(m_dispatchMutex);
+    std::set<size_t> kitchens;
+    size_t dropped = 0;
+
+    {
+        std::lock_guard<std::mutex> lock(m_ticketMutex);
+        auto it = m_tickets.lower_bound({id, 0});
+        while (it != m_tickets.end() && it->first.first == id)
+        {
+            kitchens.insert(it->second.kitchen);
+            it = m_tickets.erase(it);
+            dropped++;
+        }
+        m_orders.erase(id);
+        m_ticketCV.NotifyAll();
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(m_kitchenMutex);
+        for (const auto& kitchen : m_kitchens)
+        {
+            if (kitchens.count(kitchen->GetID()) > 0)
+            {
+                kitchen->Send(Message::Cancel{kitchen->GetID(), id});
+            }
+        }
+    }
+
+    Logger::Info(
+        "RECEPTION", "Order {} cancelled: {} pizza(s) withdrawn", id, dropped
+    );
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void Reception::FinishOrder(uint32_t id, const OrderProgress& order)
+{
+    TimePoint now = SteadyClock::Now();
+
+    m_orderLatency.Record(ToMicroseconds(now - order.enqueued));
+    Logger::Info(
+        "RECEPTION", "Order {} ready: {} pizza(s) in {}ms",
+        id, order.size, SteadyClock::DurationToMs(now - order.enqueued)
+    );
+}
+
+///////////////////////////////////////////////////////////////////////////////
+uint32_t Reception::ProcessOrders(
+    const Parser::Orders& orders,
+    size_t backlog
+)
+{
+    uint32_t id = OpenOrder();
+
+    Logger::Info(
+        "RECEPTION", "Order {} received: {} pizza(s)",
+        id, Parser::CountPizzas(orders)
+    );
+    DispatchOrder(id, orders, backlog);
+    CloseOrder(id);
+    return (id);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void Reception::WaitForBacklog(size_t limit)
+{
+    std::unique_lock<std::mutex> lock(m_ticketMutex);
+
+    while (m_tickets.size() > limit && !m_shutdown)
+    {
+        m_ticketCV.WaitFor(lock, Milliseconds(100));
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+Reception::DispatchView Reception::SnapshotKitchens(
+    std::optional<size_t> excluded
+)
+{
+    DispatchView view;
+
+    bool needsInitialKitchen = false;
+    {
+        std::lock_guard<std::mutex> lock(m_kitchenMutex);
+        if (m_kitchens.empty())
+        {
+            needsInitialKitchen = true;
+        }
+    }
+    if (needsInitialKitchen)
+    {
+        CreateKitchen();
+    }
+
+    std::lock_guard<std::mutex> lock(m_kitchenMutex);
+    for (const auto& kitchen : m_kitchens)
+    {
+        if (kitchen->GetID() == excluded)
+        {
+            continue;
+        }
+        view.allStatus.push_back(kitchen->status);
+        view.available[kitchen->GetID()] = GetAvailableStock(kitchen->status);
+    }
+    return (view);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void Reception::DispatchPizza(
+    DispatchView& view,
+    const Message::Order& order,
+    const Recipe& recipe,
+    std::optional<size_t> preferred
+)
+{
+    Message::Status* target = nullptr;
+    Tracer::Scope trace(
+        Tracer::Event::DISPATCH, order.pizza.GetOrder()
+    );
+    auto thief = std::find_if(view.allStatus.begin(), view.allStatus.end(),
+        [preferred](const Message::Status& st) {
+            return (st.id == preferred);
+        });
+
+    if (thief != view.allStatus.end() && HasCapacity(*thief))
+    {
+        target = &*thief;
+    }
+    else if (m_policy == DispatchPolicy::EARLIEST_FINISH)
+    {
+        target = SelectEarliestFinish(view.allStatus, view.available, recipe);
+    }
+    else
+    {
+        target = SelectGreedy(view.allStatus, view.available, recipe);
+    }
+
+    if (!target)
+    {
+        CreateKitchen();
+
+        std::lock_guard<std::mutex> lock(m_kitchenMutex);
+        view.allStatus.push_back(m_kitchens.back()->status);
+        view.available[view.allStatus.back().id] =
+            GetAvailableStock(view.allStatus.back());
+        target = &view.allStatus.back();
+    }
+
+    {
+        // Tracked even if the send fails: a crashed kitchen's pizzas come
+        // back through its Died message.
+        std::lock_guard<std::mutex> lock(m_ticketMutex);
+        auto it = m_tickets.find({order.pizza.GetOrder(), order.sequence});
+        if (it == m_tickets.end())
+        {
+            // Already cooked, or its order was cancelled
+            return;
+        }
+        it->second.kitchen = target->id;
+        it->second.dispatched = SteadyClock::Now();
+    }
+
+    trace.arg1 = static_cast<uint64_t>(order.sequence) << 32 | target->id;
+    if (auto kitchen = GetKitchenByID(target->id))
+    {
+        std::lock_guard<std::mutex> lock(m_kitchenMutex);
+        kitchen.value()->Send(Message::Order{
+            target->id, order.pizza, order.sequence
+        });
+    }
+    else
+    {
+        // Closed or parked since the view was taken: choose again without it
+        view.available.erase(target->id);
+        view.allStatus.erase(view.allStatus.begin() +
+            (target - view.allStatus.data()));
+        DispatchPizza(view, order, recipe, preferred);
+        return;
+    }
+
+    if (target->idleCount > 0)
+    {
+        target->idleCount--;
+    }
+    else
+    {
+        target->pizzaCount++;
+    }
+    target->pizzaTime += recipe.GetCookingTime().count();
+
+    view.available[target->id] -= recipe.needs;
+
+    Logger::Debug(
+        "RECEPTION", "{} dispatched to kitchen {}", recipe, target->id
+    );
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void Reception::Dispatch(
+    const std::vector<Message::Order>& orders,
+    std::optional<size_t> excluded,
+    std::optional<size_t> preferred
+)
+{
+    if (orders.empty())
+    {
+        return;
+    }
+
+    std::lock_guard<std::mutex> dispatchLock(m_dispatchMutex);
+    DispatchView view = SnapshotKitchens(excluded);
+
+    for (const auto& order : orders)
+    {
+        if (const Recipe* recipe = RecipeBook::Unpack(order.pizza))
+        {
+            DispatchPizza(view, order, *recipe, preferred);
         }
     }
 }
@@ -6,13 +6,19 @@
 ///////////////////////////////////////////////////////////////////////////////
 // Dependencies
 ///////////////////////////////////////////////////////////////////////////////
-#include "Kitchen/Kitchen.hpp"
+#include "Kitchen/KitchenHandle.hpp"
+#include "Kitchen/Stock.hpp"
+#include "Kitchen/Zygote.hpp"
 #include "Utils/Timer.hpp"
-#include "Pizza/IPizza.hpp"
+#include "Utils/Histogram.hpp"
+#include "Utils/Metrics.hpp"
+#include "Pizza/Recipe.hpp"
 #include "Reception/Parser.hpp"
 #include "IPC/Pipe.hpp"
 #include <optional>
 #include <memory>
+#include <unordered_map>
+#include <map>
 
 ///////////////////////////////////////////////////////////////////////////////
 //
@@ -36,17 +42,127 @@ namespace Plazza
 ///////////////////////////////////////////////////////////////////////////////
 class Reception
 {
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief How a pizza picks the kitchen it is sent to
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    enum class DispatchPolicy
+    {
+        GREEDY,             //<! Most idle kitchen first
+        EARLIEST_FINISH     //<! Kitchen predicted to finish it first
+    };
+
+private:
+    ///////////////////////////////////////////////////////////////////////////
+    //
+    ///////////////////////////////////////////////////////////////////////////
+    using StockMap = std::unordered_map<size_t, Stock::Quantities>;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Metric label of each ingredient, in Ingredient order
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static constexpr const char* INGREDIENT_LABELS[Stock::INGREDIENT_COUNT] = {
+        "dough", "tomato", "gruyere", "ham", "mushroom", "steak",
+        "eggplant", "goat_cheese", "chief_love"
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief How long the pool trusts its last read of /proc/meminfo
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static constexpr Milliseconds MEMORY_CHECK_INTERVAL = Milliseconds(5000);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Delay before pizzas no kitchen could take are dispatched again
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static constexpr Milliseconds REDISPATCH_RETRY = Milliseconds(1000);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief A kitchen waiting in the pool for Activate
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    struct PooledKitchen
+    {
+        std::shared_ptr<KitchenHandle> kitchen; //<!
+        TimePoint parkedAt;                     //<!
+        bool hibernated;                        //<! False if pre-forked
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Where a pizza of a customer order is, and since when
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    struct Ticket
+    {
+        PackedPizza pizza;                      //<! Carries the order
+        size_t kitchen;                         //<! Last kitchen it was sent to
+        TimePoint enqueued;                     //<! Order typed in the CLI
+        TimePoint dispatched;                   //<! Last sent to a kitchen
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief A customer order, done once remaining drops to zero
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    struct OrderProgress
+    {
+        TimePoint enqueued;                     //<!
+        size_t size;                            //<!
+        size_t remaining;                       //<!
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    //
+    ///////////////////////////////////////////////////////////////////////////
+    using TicketKey = std::pair<uint32_t, uint32_t>;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief What a dispatch pass knows of the kitchens, updated as it sends
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    struct DispatchView
+    {
+        std::vector<Message::Status> allStatus; //<!
+        StockMap available;                     //<!
+    };
+
 private:
     ///////////////////////////////////////////////////////////////////////////
     //
     ///////////////////////////////////////////////////////////////////////////
-    std::vector<std::shared_ptr<Kitchen>> m_kitchens;   //<!
+    std::vector<std::shared_ptr<KitchenHandle>> m_kitchens; //<!
     Milliseconds m_restockTime;                         //<!
     size_t m_cookCount;                                 //<!
+    DispatchPolicy m_policy;                            //<!
+    Zygote* m_zygote;                                   //<! May be null
+    KitchenHandle::IdlePolicy m_idle;                   //<!
+    bool m_respawn;                                     //<! Replace dead kitchens
+    std::vector<PooledKitchen> m_pool;                  //<! Pre-forked or hibernated
+    std::atomic<size_t> m_createdCount;                 //<! Kitchen processes forked
+    std::atomic<size_t> m_reusedCount;                  //<! Hibernated kitchens revived
+    size_t m_poolMin;                                   //<!
+    size_t m_poolMax;                                   //<!
+    size_t m_poolTarget;                                //<! Between min and max
+    Mutex m_poolMutex;                                  //<!
+    CondVar m_poolCV;                                   //<!
+    Thread m_poolThread;                                //<!
     std::unique_ptr<Pipe> m_pipe;                       //<!
     Thread m_manager;                                   //<!
     std::atomic<bool> m_shutdown;                       //<!
     Mutex m_kitchenMutex;                               //<!
+    Mutex m_dispatchMutex;                              //<! Serializes Dispatch
+    std::map<TicketKey, Ticket> m_tickets;              //<! Pizzas not cooked yet
+    std::unordered_map<uint32_t, OrderProgress> m_orders; //<!
+    uint32_t m_nextOrderId;                             //<! Wraps at 2^32
+    Mutex m_ticketMutex;                                //<! Innermost lock
+    CondVar m_ticketCV;                                 //<! Per cooked pizza
+    Histogram& m_dispatchLatency;                       //<! Enqueued to dispatched
+    Histogram& m_queueWait;                             //<! Dispatched to started
+    Histogram& m_cookTime;                              //<! Started to done
+    Histogram& m_orderLatency;                          //<! Whole order, end to end
 
 public:
     ///////////////////////////////////////////////////////////////////////////
@@ -54,9 +170,26 @@ public:
     ///
     /// \param restockTime
     /// \param cookCount
+    /// \param policy
+    /// \param poolMin Kitchens kept pre-forked at all times
+    /// \param poolMax Upper bound the pool may grow to after bursts
+    /// \param idle
+    /// \param respawn Start a new kitchen whenever one dies unexpectedly
+    /// \param zygote Forks the kitchens if set, must outlive the Reception
     ///
     ///////////////////////////////////////////////////////////////////////////
-    Reception(Milliseconds restockTime, size_t cookCount);
+    Reception(
+        Milliseconds restockTime,
+        size_t cookCount,
+        DispatchPolicy policy = DispatchPolicy::GREEDY,
+        size_t poolMin = 0,
+        size_t poolMax = 0,
+        KitchenHandle::IdlePolicy idle = {
+            Milliseconds(5000), Milliseconds(0)
+        },
+        bool respawn = false,
+        Zygote* zygote = nullptr
+    );
 
     ///////////////////////////////////////////////////////////////////////////
     /// \brief
@@ -73,21 +206,209 @@ private:
     /// \return
     ///
     ///////////////////////////////////////////////////////////////////////////
-    std::optional<std::shared_ptr<Kitchen>> GetKitchenByID(size_t id);
+    std::optional<std::shared_ptr<KitchenHandle>> GetKitchenByID(size_t id);
 
     ///////////////////////////////////////////////////////////////////////////
-    /// \brief
+    /// \brief Put a new kitchen into service, from the pool if possible
     ///
     ///////////////////////////////////////////////////////////////////////////
     void CreateKitchen(void);
 
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Keep m_poolTarget parked kitchens forked in the background
+    ///
+    /// Hibernated kitchens beyond m_poolMin are torn down once their TTL
+    /// expires, or right away when the machine runs low on memory.
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void PoolRoutine(void);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Move a kitchen that hibernated from service into the pool
+    ///
+    /// \param id
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void ParkKitchen(size_t id);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Close the ticket of a cooked pizza, announce it and log its
+    /// latency; later reports of the same pizza are ignored
+    ///
+    /// \param cooked
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void CompleteTicket(const Message::CookedPizza& cooked);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Record the latency of a finished order and announce it
+    ///
+    /// \param id
+    /// \param order
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void FinishOrder(uint32_t id, const OrderProgress& order);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Send pizzas that already have a ticket to the best kitchens
+    ///
+    /// \param orders
+    /// \param excluded Kitchen that must not receive these pizzas
+    /// \param preferred Kitchen that gets them while it has room
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void Dispatch(
+        const std::vector<Message::Order>& orders,
+        std::optional<size_t> excluded = std::nullopt,
+        std::optional<size_t> preferred = std::nullopt
+    );
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Dispatch pizzas taken back from a kitchen, surviving failures
+    ///
+    /// A kitchen that cannot be created, such as when the zygote is stuck,
+    /// is logged instead of ending the manager thread.
+    ///
+    /// \param orders
+    /// \param from Kitchen they came from, excluded
+    /// \param preferred As for Dispatch
+    ///
+    /// \return The pizzas that were not sent anywhere
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    std::vector<Message::Order> Redispatch(
+        const std::vector<Message::Order>& orders,
+        size_t from,
+        std::optional<size_t> preferred = std::nullopt
+    );
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Copy the status of every kitchen, creating the first one
+    ///
+    /// \param excluded
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    DispatchView SnapshotKitchens(std::optional<size_t> excluded);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Send one ticketed pizza to the best kitchen of the view
+    ///
+    /// \param view Charged with the pizza once sent
+    /// \param order
+    /// \param recipe The recipe of order.pizza
+    /// \param preferred Chosen over the policy while it has room
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void DispatchPizza(
+        DispatchView& view,
+        const Message::Order& order,
+        const Recipe& recipe,
+        std::optional<size_t> preferred = std::nullopt
+    );
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Drop a kitchen whose process died without being asked to
+    ///
+    /// \param id
+    /// \param crashed
+    ///
+    /// \return The pizzas it was sent and never cooked, to dispatch again
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    std::vector<Message::Order> LoseKitchen(size_t id, bool crashed);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Find the kitchens forked without a zygote that have died
+    ///
+    /// \return The id of each, and whether it crashed, for LoseKitchen
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    std::vector<std::pair<size_t, bool>> ReapKitchens(void);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Mirror a kitchen status into the per-kitchen gauges
+    ///
+    /// \param status
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static void ExportStatus(const Message::Status& status);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Drop the gauges of a kitchen that left service
+    ///
+    /// \param id
+    /// \param reason Counted as a closed kitchen if not empty
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static void ForgetKitchenMetrics(size_t id, const std::string& reason);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param recipe
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static void CountCookedPizza(const Recipe& recipe);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param id
+    ///
+    /// \return Queue wait of one kitchen, in microseconds
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static Histogram& GetKitchenQueueWait(size_t id);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Print one histogram as a line of the stats command
+    ///
+    /// \param name
+    /// \param histogram Recorded in microseconds
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static void DisplayHistogram(
+        const std::string& name,
+        const Histogram& histogram
+    );
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param duration
+    ///
+    /// \return The duration in microseconds, zero if negative
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static uint64_t ToMicroseconds(TimePoint::duration duration);
+
     ///////////////////////////////////////////////////////////////////////////
     /// \brief
     ///
+    /// \return True if less than a tenth of the memory is available
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static bool IsMemoryLow(void);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \param id
+    ///
+    /// \return Every pizza last sent to that kitchen and not yet cooked
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    std::vector<Message::Order> GetTickets(size_t id);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Forget a kitchen that closed itself for being idle
+    ///
     /// \param id
     ///
+    /// \return Pizzas sent to it after it decided to close, to dispatch again
+    ///
     ///////////////////////////////////////////////////////////////////////////
-    void RemoveKitchen(size_t id);
+    std::vector<Message::Order> RemoveKitchen(size_t id);
 
     ///////////////////////////////////////////////////////////////////////////
     /// \brief
@@ -95,7 +416,100 @@ private:
     ///////////////////////////////////////////////////////////////////////////
     void ManagerThread(void);
 
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Move queued pizzas out of busy kitchens while others are idle
+    ///
+    /// An idle kitchen steals from the one expected to finish last, if that
+    /// is at least one cooking time after itself. Stolen pizzas come back
+    /// through the manager thread and go to the idle kitchen while it has
+    /// room, and through the dispatch policy otherwise.
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void BalanceKitchens(void);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Stock a kitchen has left once its queued pizzas are served
+    ///
+    /// \param status
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static Stock::Quantities GetAvailableStock(const Message::Status& status);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Whether a kitchen may still accept a pizza
+    ///
+    /// \param status
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    bool HasCapacity(const Message::Status& status) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Predict in how many milliseconds a kitchen would finish a pizza
+    ///
+    /// The pizza starts once a cook frees up (queued time spread over the
+    /// cooks) or once the restock thread has refilled its missing
+    /// ingredients, whichever comes last.
+    ///
+    /// \param status
+    /// \param available
+    /// \param recipe
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    int64_t EstimateCompletion(
+        const Message::Status& status,
+        const Stock::Quantities& available,
+        const Recipe& recipe
+    ) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param allStatus
+    /// \param available
+    /// \param recipe
+    ///
+    /// \return The chosen kitchen, or nullptr if every kitchen is full
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    Message::Status* SelectGreedy(
+        std::vector<Message::Status>& allStatus,
+        StockMap& available,
+        const Recipe& recipe
+    );
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param allStatus
+    /// \param available
+    /// \param recipe
+    ///
+    /// \return The chosen kitchen, or nullptr if every kitchen is full
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    Message::Status* SelectEarliestFinish(
+        std::vector<Message::Status>& allStatus,
+        StockMap& available,
+        const Recipe& recipe
+    );
+
 public:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param name "greedy" or "earliest"
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static DispatchPolicy ParseDispatchPolicy(const std::string& name);
+
     ///////////////////////////////////////////////////////////////////////////
     /// \brief
     ///
@@ -103,12 +517,75 @@ public:
     void DisplayStatus(void);
 
     ///////////////////////////////////////////////////////////////////////////
-    /// \brief
+    /// \brief Print latency percentiles recorded since startup
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void DisplayStats(void);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Open a customer order and dispatch its pizzas
+    ///
+    /// Pizzas are packed and ticketed one at a time as they are sent, so a
+    /// line such as `regina S x100000` is never expanded up front.
     ///
     /// \param orders
+    /// \param backlog If not 0, wait before sending a pizza while that many
+    /// are already waiting to be cooked
+    ///
+    /// \return The id of the new order
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    uint32_t ProcessOrders(const Parser::Orders& orders, size_t backlog = 0);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Open a customer order whose pizzas come in several parts
+    ///
+    /// It cannot be reported ready before CloseOrder.
+    ///
+    /// \return The id of the new order
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    uint32_t OpenOrder(void);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Dispatch the next part of an open order
+    ///
+    /// \param id
+    /// \param orders Numbered after the parts dispatched before
+    /// \param backlog As for ProcessOrders
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void DispatchOrder(
+        uint32_t id,
+        const Parser::Orders& orders,
+        size_t backlog = 0
+    );
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Mark an open order complete, once every part is dispatched
+    ///
+    /// \param id
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void CloseOrder(uint32_t id);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Withdraw an open order and every pizza of it not cooked yet
+    ///
+    /// Kitchens holding some of them are told to drop them from their queue.
+    ///
+    /// \param id
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void CancelOrder(uint32_t id);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Block until at most limit pizzas are waiting to be cooked
+    ///
+    /// \param limit 0 to wait for every order to be ready
     ///
     ///////////////////////////////////////////////////////////////////////////
-    void ProcessOrders(const Parser::Orders& orders);
+    void WaitForBacklog(size_t limit);
 
 #ifdef PLAZZA_BONUS
 private:
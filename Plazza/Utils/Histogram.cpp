@@ -0,0 +1,136 @@
+///////////////////////////////////////////////////////////////////////////////
+// Dependencies
+///////////////////////////////////////////////////////////////////////////////
+#include "Utils/Histogram.hpp"
+#include <algorithm>
+#include <bit>
+#include <cmath>
+
+///////////////////////////////////////////////////////////////////////////////
+// Namespace Plazza
+///////////////////////////////////////////////////////////////////////////////
+namespace Plazza
+{
+
+///////////////////////////////////////////////////////////////////////////////
+Histogram::Histogram(void)
+{
+    for (auto& shard : m_shards)
+    {
+        shard.max.store(0, std::memory_order_relaxed);
+        shard.sum.store(0, std::memory_order_relaxed);
+        for (auto& bucket : shard.buckets)
+        {
+            bucket.store(0, std::memory_order_relaxed);
+        }
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+size_t Histogram::GetShardIndex(void)
+{
+    static std::atomic<size_t> nextIndex(0);
+    thread_local size_t index =
+        nextIndex.fetch_add(1, std::memory_order_relaxed) % SHARD_COUNT;
+
+    return (index);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+size_t Histogram::GetBucketIndex(uint64_t value)
+{
+    if (value < SUB_BUCKET_COUNT)
+    {
+        return (static_cast<size_t>(value));
+    }
+
+    if (value >> MAX_VALUE_BITS)
+    {
+        return (BUCKET_COUNT - 1);
+    }
+
+    size_t msb = static_cast<size_t>(std::bit_width(value)) - 1;
+    size_t shift = msb - SUB_BUCKET_BITS + 1;
+
+    return (shift * SUB_BUCKET_HALF + static_cast<size_t>(value >> shift));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+uint64_t Histogram::GetBucketValue(size_t index)
+{
+    if (index < SUB_BUCKET_COUNT)
+    {
+        return (index);
+    }
+
+    size_t shift = index / SUB_BUCKET_HALF - 1;
+    uint64_t sub = index % SUB_BUCKET_HALF + SUB_BUCKET_HALF;
+
+    return (((sub + 1) << shift) - 1);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void Histogram::Record(uint64_t value)
+{
+    Shard& shard = m_shards[GetShardIndex()];
+
+    shard.buckets[GetBucketIndex(value)].fetch_add(
+        1, std::memory_order_relaxed
+    );
+    shard.sum.fetch_add(value, std::memory_order_relaxed);
+
+    uint64_t max = shard.max.load(std::memory_order_relaxed);
+    while (value > max && !shard.max.compare_exchange_weak(
+        max, value, std::memory_order_relaxed
+    ))
+    {}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+Histogram::Snapshot Histogram::Read(void) const
+{
+    Snapshot snapshot{0, 0, 0, {}};
+
+    for (const auto& shard : m_shards)
+    {
+        snapshot.max = std::max(
+            snapshot.max, shard.max.load(std::memory_order_relaxed)
+        );
+        snapshot.sum += shard.sum.load(std::memory_order_relaxed);
+        for (size_t i = 0; i < BUCKET_COUNT; i++)
+        {
+            uint64_t count = shard.buckets[i].load(std::memory_order_relaxed);
+
+            snapshot.buckets[i] += count;
+            snapshot.count += count;
+        }
+    }
+
+    return (snapshot);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+uint64_t Histogram::Snapshot::ValueAt(double percentile) const
+{
+    if (count == 0)
+    {
+        return (0);
+    }
+
+    double rank = std::ceil(std::clamp(percentile, 0.0, 100.0) / 100.0 * count);
+    uint64_t target = std::max<uint64_t>(1, static_cast<uint64_t>(rank));
+    uint64_t seen = 0;
+
+    for (size_t i = 0; i < BUCKET_COUNT; i++)
+    {
+        seen += buckets[i];
+        if (seen >= target)
+        {
+            return (std::min(GetBucketValue(i), max));
+        }
+    }
+
+    return (max);
+}
+
+} // !namespace Plazza
@@ -0,0 +1,144 @@
+///////////////////////////////////////////////////////////////////////////////
+// Header guard
+///////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+///////////////////////////////////////////////////////////////////////////////
+// Dependencies
+///////////////////////////////////////////////////////////////////////////////
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+///////////////////////////////////////////////////////////////////////////////
+// Namespace Plazza
+///////////////////////////////////////////////////////////////////////////////
+namespace Plazza
+{
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Log-linear histogram of positive values, in the spirit of HDR
+///
+/// Values below 32 get a bucket each; above that, every power of two is
+/// split into 16 linear buckets, so a value is known within about 6%.
+/// Record only touches atomics of the calling thread's shard: no lock, no
+/// allocation. Shards are summed when the histogram is read.
+///
+///////////////////////////////////////////////////////////////////////////////
+class Histogram
+{
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    //
+    ///////////////////////////////////////////////////////////////////////////
+    static constexpr size_t SUB_BUCKET_BITS = 5;
+    static constexpr size_t SUB_BUCKET_COUNT = 1 << SUB_BUCKET_BITS;
+    static constexpr size_t SUB_BUCKET_HALF = SUB_BUCKET_COUNT / 2;
+    static constexpr size_t MAX_VALUE_BITS = 40;
+    static constexpr size_t BUCKET_COUNT =
+        (MAX_VALUE_BITS - SUB_BUCKET_BITS + 2) * SUB_BUCKET_HALF;
+    static constexpr size_t SHARD_COUNT = 8;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Merged copy of every shard, taken by Read
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    struct Snapshot
+    {
+        uint64_t count;                                 //<!
+        uint64_t max;                                   //<! Exact
+        uint64_t sum;                                   //<! Exact
+        std::array<uint64_t, BUCKET_COUNT> buckets;     //<!
+
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief
+        ///
+        /// \param percentile Between 0 and 100
+        ///
+        /// \return Highest value of the bucket holding that percentile,
+        /// never above max
+        ///
+        ///////////////////////////////////////////////////////////////////////
+        uint64_t ValueAt(double percentile) const;
+    };
+
+private:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Counters written by the threads mapped to it
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    struct alignas(64) Shard
+    {
+        std::atomic<uint64_t> max;                              //<!
+        std::atomic<uint64_t> sum;                              //<!
+        std::array<std::atomic<uint64_t>, BUCKET_COUNT> buckets; //<!
+    };
+
+private:
+    ///////////////////////////////////////////////////////////////////////////
+    //
+    ///////////////////////////////////////////////////////////////////////////
+    std::array<Shard, SHARD_COUNT> m_shards;            //<!
+
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    Histogram(void);
+
+    ///////////////////////////////////////////////////////////////////////////
+    //
+    ///////////////////////////////////////////////////////////////////////////
+    Histogram(const Histogram&) = delete;
+    Histogram& operator=(const Histogram&) = delete;
+
+private:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Shard of the calling thread, picked once per thread
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static size_t GetShardIndex(void);
+
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param value
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static size_t GetBucketIndex(uint64_t value);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param index
+    ///
+    /// \return Highest value that falls in that bucket
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static uint64_t GetBucketValue(size_t index);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Count one value, safe from any thread
+    ///
+    /// \param value Clamped into the last bucket past 2^40, max stays exact
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void Record(uint64_t value);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    Snapshot Read(void) const;
+};
+
+} // !namespace Plazza
@@ -2,8 +2,26 @@
 // Dependencies
 ///////////////////////////////////////////////////////////////////////////////
 #include "Utils/Logger.hpp"
-#include <iomanip>
-#include <sstream>
+#include "Concurrency/CondVar.hpp"
+#include "Concurrency/Mutex.hpp"
+#include "Concurrency/Thread.hpp"
+#include "Utils/Timer.hpp"
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <csignal>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <fcntl.h>
+#include <filesystem>
+#include <memory>
+#include <pthread.h>
+#include <sys/mman.h>
+#include <thread>
+#include <unistd.h>
+#include <unordered_map>
+#include <vector>
 
 ///////////////////////////////////////////////////////////////////////////////
 // Namespace Plazza
@@ -12,109 +30,641 @@ namespace Plazza
 {
 
 ///////////////////////////////////////////////////////////////////////////////
-std::string Logger::m_logFilePath = "";
-
+// Per-thread rings and the flusher state
 ///////////////////////////////////////////////////////////////////////////////
-bool Logger::m_consoleOutput = true;
+namespace
+{
 
-///////////////////////////////////////////////////////////////////////////////
-Mutex Logger::m_logMutex;
+constexpr size_t RING_CAPACITY = 1024;
+constexpr size_t BATCH_SIZE = 64 * 1024;
+constexpr Milliseconds FLUSH_INTERVAL(20);
+constexpr Milliseconds URGENT_WAIT(10);
+
+struct Entry
+{
+    int64_t time = 0;
+    Logger::Level level = Logger::Level::INFO;
+    const char* sender = "";
+    std::string message;
+};
+
+// Single producer, the owning thread; single consumer, whoever drains under
+// the backend lock. Slots keep their strings, so steady logging reuses them.
+struct Ring
+{
+    std::array<Entry, RING_CAPACITY> entries;
+    std::atomic<size_t> head{0};
+    std::atomic<size_t> tail{0};
+    std::atomic<uint64_t> dropped{0};
+    std::atomic<bool> orphaned{false};
+};
+
+struct Backend
+{
+    Mutex mutex;
+    CondVar wakeup;
+    std::vector<std::shared_ptr<Ring>> rings;
+    Thread* flusher = nullptr;
+    std::atomic<bool> running{false};
+    bool stopping = false;
+    bool closed = false;
+    int fd = -1;
+    std::atomic<bool> console{true};
+    std::string batch;
+    int64_t second = -1;
+    char timestamp[32] = {};
+
+    // Binary mode
+    std::atomic<bool> binary{false};
+    std::string directory;
+    Mutex internMutex;
+    Mutex segmentMutex;
+    std::unordered_map<const char*, uint16_t> ids;
+    std::atomic<uint64_t> generation{0};
+    std::atomic<Logger::SegmentHeader*> segment{nullptr};
+
+    Backend(void);
+};
+
+// Never destroyed, so objects torn down after exit started may still log.
+Backend& GetBackend(void)
+{
+    static Backend* backend = new Backend();
+
+    return (*backend);
+}
+
+struct RingHandle
+{
+    std::shared_ptr<Ring> ring = std::make_shared<Ring>();
+
+    RingHandle(void)
+    {
+        Backend& backend = GetBackend();
+        std::lock_guard<std::mutex> lock(backend.mutex);
+
+        backend.rings.push_back(ring);
+    }
+
+    ~RingHandle()
+    {
+        ring->orphaned.store(true, std::memory_order_release);
+    }
+};
+
+thread_local RingHandle t_ring;
+
+void WriteAll(int fd, std::string_view text)
+{
+    while (fd != -1 && !text.empty())
+    {
+        ssize_t written = write(fd, text.data(), text.size());
+        if (written <= 0)
+        {
+            break;
+        }
+        text.remove_prefix(static_cast<size_t>(written));
+    }
+}
+
+Backend::Backend(void)
+{
+    batch.reserve(BATCH_SIZE * 2);
+
+    // Only the forking thread survives a fork: the child gets no flusher, and
+    // the lines it inherited are written by the parent.
+    pthread_atfork(
+        []() {
+            GetBackend().mutex.Lock();
+            GetBackend().internMutex.Lock();
+            GetBackend().segmentMutex.Lock();
+        },
+        []() {
+            GetBackend().segmentMutex.Unlock();
+            GetBackend().internMutex.Unlock();
+            GetBackend().mutex.Unlock();
+        },
+        []() {
+            Backend& backend = GetBackend();
+
+            // The parent's segments stay the parent's: the child maps its own
+            // and defines its strings again.
+            backend.segment = nullptr;
+            backend.ids.clear();
+            backend.generation++;
+            backend.segmentMutex.Unlock();
+            backend.internMutex.Unlock();
+
+            backend.mutex.Unlock();
+            backend.flusher = nullptr;
+            backend.running = false;
+            backend.stopping = false;
+            backend.closed = false;
+            backend.batch.clear();
+
+            std::shared_ptr<Ring> ring = t_ring.ring;
+            std::lock_guard<std::mutex> lock(backend.mutex);
+
+            backend.rings.assign(1, ring);
+            ring->tail.store(ring->head.load());
+            ring->dropped = 0;
+        }
+    );
+}
+
+}
 
 ///////////////////////////////////////////////////////////////////////////////
 void Logger::SetLogFile(const std::string& filePath)
 {
-    std::lock_guard<std::mutex> lock(m_logMutex);
-    m_logFilePath = filePath;
+    Backend& backend = GetBackend();
+    std::lock_guard<std::mutex> lock(backend.mutex);
+
+    if (backend.fd != -1)
+    {
+        close(backend.fd);
+    }
+    backend.fd = open(
+        filePath.c_str(), O_WRONLY | O_CREAT | O_APPEND | O_CLOEXEC, 0644
+    );
 }
 
 ///////////////////////////////////////////////////////////////////////////////
 void Logger::SetConsoleOutput(bool enable)
 {
-    std::lock_guard<std::mutex> lock(m_logMutex);
-    m_consoleOutput = enable;
+    GetBackend().console = enable;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void Logger::SetBinaryOutput(const std::string& directory)
+{
+    Backend& backend = GetBackend();
+
+    std::filesystem::create_directories(directory);
+
+    std::lock_guard<std::mutex> lock(backend.segmentMutex);
+    backend.directory = directory;
+    backend.binary = true;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void Logger::Flush(void)
+{
+    Backend& backend = GetBackend();
+    std::lock_guard<std::mutex> lock(backend.mutex);
+
+    Drain();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void Logger::InstallCrashHandler(void)
+{
+    struct sigaction action = {};
+
+    action.sa_handler = &Logger::OnCrash;
+    action.sa_flags = SA_RESETHAND;
+    sigemptyset(&action.sa_mask);
+
+    for (int signal : {SIGSEGV, SIGBUS, SIGFPE, SIGILL, SIGABRT})
+    {
+        sigaction(signal, &action, nullptr);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+std::string* Logger::BeginLine(Level level, const char* sender)
+{
+    Backend& backend = GetBackend();
+    Ring& ring = *t_ring.ring;
+    size_t head = ring.head.load(std::memory_order_relaxed);
+
+    if (head - ring.tail.load(std::memory_order_acquire) >= RING_CAPACITY)
+    {
+        if (!backend.running.load(std::memory_order_acquire))
+        {
+            StartFlusher();
+        }
+
+        bool urgent = level == Level::WARNING || level == Level::ERROR;
+        TimePoint deadline = SteadyClock::Now() + URGENT_WAIT;
+
+        while (urgent && SteadyClock::Now() < deadline &&
+            head - ring.tail.load(std::memory_order_acquire) >= RING_CAPACITY)
+        {
+            backend.wakeup.NotifyOne();
+            std::this_thread::yield();
+        }
+        if (head - ring.tail.load(std::memory_order_acquire) >= RING_CAPACITY)
+        {
+            ring.dropped.fetch_add(1, std::memory_order_relaxed);
+            return (nullptr);
+        }
+    }
+
+    Entry& entry = ring.entries[head % RING_CAPACITY];
+    entry.time = std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::system_clock::now().time_since_epoch()
+    ).count();
+    entry.level = level;
+    entry.sender = sender;
+    entry.message.clear();
+    return (&entry.message);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void Logger::EndLine(void)
+{
+    Backend& backend = GetBackend();
+    Ring& ring = *t_ring.ring;
+    size_t head = ring.head.load(std::memory_order_relaxed) + 1;
+
+    ring.head.store(head, std::memory_order_release);
+
+    if (!backend.running.load(std::memory_order_acquire))
+    {
+        StartFlusher();
+    }
+    else if (head - ring.tail.load(std::memory_order_relaxed) ==
+        RING_CAPACITY / 2)
+    {
+        // Bursts wake the flusher early instead of filling the ring
+        backend.wakeup.NotifyOne();
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+bool Logger::IsBinary(void)
+{
+    return (GetBackend().binary.load(std::memory_order_relaxed));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+uint16_t Logger::Intern(const char* text)
+{
+    thread_local std::unordered_map<const char*, uint16_t> t_ids;
+    thread_local uint64_t t_generation = 0;
+    Backend& backend = GetBackend();
+    uint64_t generation = backend.generation.load(std::memory_order_acquire);
+
+    if (generation != t_generation)
+    {
+        t_ids.clear();
+        t_generation = generation;
+    }
+
+    auto cached = t_ids.find(text);
+    if (cached != t_ids.end())
+    {
+        return (cached->second);
+    }
+
+    std::lock_guard<std::mutex> lock(backend.internMutex);
+    uint16_t id = static_cast<uint16_t>(backend.ids.size() + 1);
+    auto [it, created] = backend.ids.try_emplace(text, id);
+
+    if (created)
+    {
+        std::string_view view(text);
+        size_t size = sizeof(RecordHeader) + GetEncodedSize(view);
+
+        size = (size + 7) & ~static_cast<size_t>(7);
+        if (RecordHeader* record = ReserveRecord(size))
+        {
+            char* out = reinterpret_cast<char*>(record + 1);
+
+            record->time = 0;
+            record->sender = 0;
+            record->format = id;
+            record->level = 0;
+            record->kind = static_cast<uint8_t>(RecordKind::STRING);
+            record->argCount = 1;
+            Encode(out, view);
+            EndRecord(record, size);
+        }
+    }
+
+    t_ids[text] = it->second;
+    return (it->second);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+Logger::RecordHeader* Logger::ReserveRecord(size_t size)
+{
+    SegmentHeader* segment = GetBackend().segment.load(
+        std::memory_order_acquire
+    );
+
+    if (size > SEGMENT_SIZE / 2)
+    {
+        return (nullptr);
+    }
+
+    while (true)
+    {
+        if (!segment)
+        {
+            segment = OpenSegment(nullptr);
+        }
+        if (!segment)
+        {
+            return (nullptr);
+        }
+
+        uint64_t offset = std::atomic_ref<uint64_t>(segment->cursor)
+            .fetch_add(size, std::memory_order_relaxed);
+
+        if (offset + size <= segment->capacity)
+        {
+            return (reinterpret_cast<RecordHeader*>(
+                reinterpret_cast<char*>(segment) + offset
+            ));
+        }
+        segment = OpenSegment(segment);
+    }
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-void Logger::Log(
-    Level level,
-    const std::string& sender,
-    const std::string& message
-)
+Logger::SegmentHeader* Logger::OpenSegment(SegmentHeader* full)
 {
-    std::string logMessage = "[" + GetTimestamp() + "] "
-                           + "[" + LogLevelToString(level) + "] "
-                           + "[" + sender + "] "
-                           + message;
-    WriteLog(logMessage);
+    Backend& backend = GetBackend();
+    std::lock_guard<std::mutex> lock(backend.segmentMutex);
+    SegmentHeader* current = backend.segment.load(std::memory_order_acquire);
+
+    // Another thread already moved on
+    if (current != full)
+    {
+        return (current);
+    }
+
+    uint32_t index = full ? full->index + 1 : 0;
+    std::string path = backend.directory + "/" + std::to_string(getpid()) +
+        "-" + std::to_string(index) + ".plog";
+    int fd = open(path.c_str(), O_RDWR | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+
+    if (fd == -1)
+    {
+        return (nullptr);
+    }
+
+    void* memory = MAP_FAILED;
+    if (ftruncate(fd, SEGMENT_SIZE) == 0)
+    {
+        memory = mmap(
+            nullptr, SEGMENT_SIZE, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0
+        );
+    }
+    close(fd);
+    if (memory == MAP_FAILED)
+    {
+        return (nullptr);
+    }
+
+    // Full segments stay mapped: late writers may still be filling them.
+    SegmentHeader* segment = static_cast<SegmentHeader*>(memory);
+
+    std::memcpy(segment->magic, SEGMENT_MAGIC, sizeof(segment->magic));
+    segment->pid = static_cast<uint32_t>(getpid());
+    segment->index = index;
+    segment->cursor = sizeof(SegmentHeader);
+    segment->capacity = SEGMENT_SIZE;
+    backend.segment.store(segment, std::memory_order_release);
+    return (segment);
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-void Logger::Info(const std::string& sender, const std::string& message)
+void Logger::EndRecord(RecordHeader* record, size_t size)
 {
-    Log(Level::INFO, sender, message);
+    std::atomic_ref<uint32_t>(record->size).store(
+        static_cast<uint32_t>(size), std::memory_order_release
+    );
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-void Logger::Warning(const std::string& sender, const std::string& message)
+void Logger::StartFlusher(void)
 {
-    Log(Level::WARNING, sender, message);
+    Backend& backend = GetBackend();
+    std::lock_guard<std::mutex> lock(backend.mutex);
+
+    if (backend.running)
+    {
+        return;
+    }
+
+    if (backend.closed)
+    {
+        Drain();
+        return;
+    }
+
+    static bool registered = false;
+    if (!registered)
+    {
+        std::atexit(&Logger::StopFlusher);
+        registered = true;
+    }
+
+    backend.flusher = new Thread(&Logger::FlushRoutine);
+    backend.flusher->Start();
+    backend.running = true;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-void Logger::Error(const std::string& sender, const std::string& message)
+void Logger::StopFlusher(void)
 {
-    Log(Level::ERROR, sender, message);
+    Backend& backend = GetBackend();
+    Thread* flusher = nullptr;
+
+    {
+        std::lock_guard<std::mutex> lock(backend.mutex);
+
+        backend.stopping = true;
+        backend.closed = true;
+        flusher = backend.flusher;
+        backend.flusher = nullptr;
+    }
+
+    if (flusher)
+    {
+        backend.wakeup.NotifyAll();
+        flusher->Join();
+        delete flusher;
+    }
+    backend.running = false;
+    Flush();
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-void Logger::Debug(const std::string& sender, const std::string& message)
+void Logger::FlushRoutine(void)
 {
-    Log(Level::DEBUG, sender, message);
+    Backend& backend = GetBackend();
+    std::unique_lock<std::mutex> lock(backend.mutex);
+
+    while (!backend.stopping)
+    {
+        backend.wakeup.GetNativeHandle().wait_for(lock, FLUSH_INTERVAL);
+        Drain();
+    }
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-void Logger::WriteLog(const std::string& logMessage)
+void Logger::Drain(void)
 {
-    std::lock_guard<std::mutex> lock(m_logMutex);
+    Backend& backend = GetBackend();
+    std::vector<size_t> heads(backend.rings.size());
+    uint64_t dropped = 0;
 
-    if (m_consoleOutput)
+    for (size_t i = 0; i < backend.rings.size(); i++)
     {
-        std::cout << logMessage << std::endl;
+        heads[i] = backend.rings[i]->head.load(std::memory_order_acquire);
+        dropped += backend.rings[i]->dropped.exchange(0);
     }
 
-    if (!m_logFilePath.empty())
+    // Each ring is in time order, so repeatedly taking the oldest head of
+    // any ring interleaves the threads as they logged.
+    while (true)
     {
-        std::ofstream logFile(m_logFilePath, std::ios::app);
-        if (logFile.is_open())
+        Ring* oldest = nullptr;
+        size_t tail = 0;
+
+        for (size_t i = 0; i < backend.rings.size(); i++)
+        {
+            Ring& ring = *backend.rings[i];
+            size_t index = ring.tail.load(std::memory_order_relaxed);
+
+            if (index != heads[i] && (!oldest ||
+                ring.entries[index % RING_CAPACITY].time <
+                oldest->entries[tail % RING_CAPACITY].time))
+            {
+                oldest = &ring;
+                tail = index;
+            }
+        }
+        if (!oldest)
+        {
+            break;
+        }
+
+        const Entry& entry = oldest->entries[tail % RING_CAPACITY];
+
+        backend.batch += '[';
+        backend.batch += GetTimestamp(entry.time / 1000000000);
+        backend.batch += "] [";
+        backend.batch += LogLevelToString(entry.level);
+        backend.batch += "] [";
+        backend.batch += entry.sender;
+        backend.batch += "] ";
+        backend.batch += entry.message;
+        backend.batch += '\n';
+        oldest->tail.store(tail + 1, std::memory_order_release);
+
+        if (backend.batch.size() >= BATCH_SIZE)
         {
-            logFile << logMessage << std::endl;
-            logFile.close();
+            WriteLog();
         }
     }
+
+    if (dropped > 0)
+    {
+        backend.batch += '[';
+        backend.batch += GetTimestamp(std::time(nullptr));
+        backend.batch += "] [" + std::string(LogLevelToString(Level::WARNING));
+        backend.batch += "] [LOGGER] " + std::to_string(dropped) +
+            " line(s) dropped, log ring full\n";
+    }
+    WriteLog();
+
+    // Rings of ended threads go once drained
+    std::erase_if(backend.rings, [](const std::shared_ptr<Ring>& ring) {
+        return (ring->orphaned.load(std::memory_order_acquire) &&
+            ring->tail.load() == ring->head.load());
+    });
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-std::string Logger::GetTimestamp(void)
+void Logger::OnCrash(int signal)
 {
-    auto now = std::time(nullptr);
-    auto localTime = *std::localtime(&now);
+    Backend& backend = GetBackend();
 
-    std::stringstream ss;
-    ss << std::put_time(&localTime, "%Y-%m-%d %H:%M:%S");
-    return (ss.str());
+    // Only write(2) from here: formatting or allocating could deadlock if
+    // the crash hit malloc. Lines still in a ring go out without their
+    // timestamp, ring by ring.
+    if (backend.mutex.TryLock())
+    {
+        for (int fd : {backend.console ? STDOUT_FILENO : -1, backend.fd})
+        {
+            WriteAll(fd, backend.batch);
+            for (const auto& ring : backend.rings)
+            {
+                size_t head = ring->head.load(std::memory_order_acquire);
+
+                for (size_t i = ring->tail.load(); i != head; i++)
+                {
+                    const Entry& entry = ring->entries[i % RING_CAPACITY];
+
+                    WriteAll(fd, "[crash] [");
+                    WriteAll(fd, LogLevelToString(entry.level));
+                    WriteAll(fd, "] [");
+                    WriteAll(fd, entry.sender);
+                    WriteAll(fd, "] ");
+                    WriteAll(fd, entry.message);
+                    WriteAll(fd, "\n");
+                }
+            }
+        }
+        backend.mutex.Unlock();
+    }
+    raise(signal);
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-std::string Logger::LogLevelToString(Level level)
+const char* Logger::GetTimestamp(int64_t seconds)
+{
+    Backend& backend = GetBackend();
+
+    if (seconds != backend.second)
+    {
+        std::time_t now = static_cast<std::time_t>(seconds);
+        std::tm localTime;
+
+        localtime_r(&now, &localTime);
+        std::strftime(
+            backend.timestamp, sizeof(backend.timestamp),
+            "%Y-%m-%d %H:%M:%S", &localTime
+        );
+        backend.second = seconds;
+    }
+    return (backend.timestamp);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+const char* Logger::LogLevelToString(Level level)
 {
     switch (level)
     {
+        case Level::DEBUG:   return ("DEBUG");
         case Level::INFO:    return ("INFO");
         case Level::WARNING: return ("WARN");
         case Level::ERROR:   return ("ERROR");
-        case Level::DEBUG:   return ("DEBUG");
         default:             return ("UNKNOWN");
     }
 }
 
+///////////////////////////////////////////////////////////////////////////////
+void Logger::WriteLog(void)
+{
+    Backend& backend = GetBackend();
+
+    if (backend.batch.empty())
+    {
+        return;
+    }
+
+    for (int fd : {backend.console ? STDOUT_FILENO : -1, backend.fd})
+    {
+        WriteAll(fd, backend.batch);
+    }
+
+    backend.batch.clear();
+}
+
 } // !namespace Plazza
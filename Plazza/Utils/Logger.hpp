@@ -6,11 +6,16 @@
 ///////////////////////////////////////////////////////////////////////////////
 // Dependencies
 ///////////////////////////////////////////////////////////////////////////////
-#include "Utils/Timer.hpp"
-#include "Concurrency/Mutex.hpp"
-#include <iostream>
+#include <cstdint>
 #include <string>
-#include <fstream>
+#include <string_view>
+
+///////////////////////////////////////////////////////////////////////////////
+// Compile-time minimum level: 0 debug, 1 info, 2 warning, 3 error
+///////////////////////////////////////////////////////////////////////////////
+#ifndef PLAZZA_LOG_LEVEL
+    #define PLAZZA_LOG_LEVEL 0
+#endif
 
 ///////////////////////////////////////////////////////////////////////////////
 // Namespace Plazza
@@ -19,19 +24,25 @@ namespace Plazza
 {
 
 ///////////////////////////////////////////////////////////////////////////////
-/// \brief
+/// \brief Asynchronous logger
+///
+/// Each thread copies its lines into its own ring, without a lock. A
+/// background flusher merges the rings in time order and writes them in
+/// large batches to a descriptor that stays open. A full ring drops debug
+/// and info lines, and holds warnings and errors back briefly before
+/// dropping them too; the flusher reports how many were lost.
+///
+/// Messages are format strings whose `{}` are replaced by the arguments,
+/// straight into the ring slot. Below PLAZZA_LOG_LEVEL a call compiles to
+/// nothing, so its arguments are neither formatted nor converted.
+///
+/// In binary mode nothing is formatted: each process appends records of
+/// raw arguments to its own memory-mapped segments, which survive a crash
+/// and which the plazza-logcat tool decodes into the same text lines.
 ///
 ///////////////////////////////////////////////////////////////////////////////
 class Logger
 {
-private:
-    ///////////////////////////////////////////////////////////////////////////
-    //
-    ///////////////////////////////////////////////////////////////////////////
-    static std::string m_logFilePath;   //<!
-    static bool m_consoleOutput;        //<!
-    static Mutex m_logMutex;            //<!
-
 public:
     ///////////////////////////////////////////////////////////////////////////
     /// \brief
@@ -39,10 +50,73 @@ public:
     ///////////////////////////////////////////////////////////////////////////
     enum class Level
     {
+        DEBUG,
         INFO,
         WARNING,
-        ERROR,
-        DEBUG
+        ERROR
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    //
+    ///////////////////////////////////////////////////////////////////////////
+    static constexpr Level MIN_LEVEL = static_cast<Level>(PLAZZA_LOG_LEVEL);
+    static constexpr uint64_t SEGMENT_SIZE = 8 * 1024 * 1024;
+    static constexpr char SEGMENT_MAGIC[8] = "PLZLOG1";
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Start of a binary segment, `<directory>/<pid>-<index>.plog`
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    struct SegmentHeader
+    {
+        char magic[8];      //<! SEGMENT_MAGIC
+        uint32_t pid;       //<!
+        uint32_t index;     //<! Segments of a process follow each other
+        uint64_t cursor;    //<! Bytes reserved, may run past capacity
+        uint64_t capacity;  //<! Size of the file
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    enum class RecordKind : uint8_t
+    {
+        STRING,     //<! Defines string id `format` as its STRING argument
+        LINE        //<! One log line
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Tag written before each argument of a record
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    enum class ArgType : uint8_t
+    {
+        BOOL,       //<! 1 byte
+        CHAR,       //<! 1 byte
+        INT,        //<! int64_t
+        UINT,       //<! uint64_t
+        DOUBLE,     //<! double
+        STRING      //<! uint16_t length, then the bytes
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Fixed part of a binary record, followed by its arguments
+    ///
+    /// Records are padded to 8 bytes. A size of 0 marks a record that was
+    /// still being written, and the end of what can be read.
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    struct RecordHeader
+    {
+        int64_t time;       //<! System clock, in nanoseconds
+        uint32_t size;      //<! Written last
+        uint16_t sender;    //<! String id
+        uint16_t format;    //<! String id
+        uint8_t level;      //<!
+        uint8_t kind;       //<!
+        uint8_t argCount;   //<!
+        uint8_t padding;    //<!
     };
 
 public:
@@ -60,7 +134,7 @@ public:
 
 public:
     ///////////////////////////////////////////////////////////////////////////
-    /// \brief
+    /// \brief Open the log file once, in append mode
     ///
     /// \param filePath
     ///
@@ -75,82 +149,328 @@ public:
     ///////////////////////////////////////////////////////////////////////////
     static void SetConsoleOutput(bool enable);
 
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Write binary segments instead of text, before any fork
+    ///
+    /// \param directory Created if missing
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static void SetBinaryOutput(const std::string& directory);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param level
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static const char* LogLevelToString(Level level);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Write out what every thread logged so far, before returning
+    ///
+    /// Processes leaving through _exit must call this, as the flusher only
+    /// drains on its own at exit.
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static void Flush(void);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Flush on SIGSEGV, SIGBUS, SIGFPE, SIGILL and SIGABRT
+    ///
+    /// Best effort: the handler skips the flush if the crash happened while
+    /// the rings were being drained. Forked children inherit it.
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static void InstallCrashHandler(void);
+
 public:
     ///////////////////////////////////////////////////////////////////////////
     /// \brief
     ///
     /// \param level
-    /// \param sender
-    /// \param message
+    ///
+    /// \return Whether lines of that level are compiled in
     ///
     ///////////////////////////////////////////////////////////////////////////
+    static constexpr bool IsEnabled(Level level)
+    {
+        return (level >= MIN_LEVEL);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param level
+    /// \param sender A string literal, kept by address
+    /// \param format Each `{}` takes the next argument
+    /// \param args Numbers, strings, or objects with a ToString method
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename... Args>
     static void Log(
         Level level,
-        const std::string& sender,
-        const std::string& message
+        const char* sender,
+        const char* format,
+        const Args&... args
     );
 
     ///////////////////////////////////////////////////////////////////////////
     /// \brief
     ///
     /// \param sender
-    /// \param message
+    /// \param format
+    /// \param args
     ///
     ///////////////////////////////////////////////////////////////////////////
-    static void Info(const std::string& sender, const std::string& message);
+    template <typename... Args>
+    static void Info(
+        const char* sender,
+        const char* format,
+        const Args&... args
+    );
 
     ///////////////////////////////////////////////////////////////////////////
     /// \brief
     ///
     /// \param sender
-    /// \param message
+    /// \param format
+    /// \param args
     ///
     ///////////////////////////////////////////////////////////////////////////
-    static void Warning(const std::string& sender, const std::string& message);
+    template <typename... Args>
+    static void Warning(
+        const char* sender,
+        const char* format,
+        const Args&... args
+    );
 
     ///////////////////////////////////////////////////////////////////////////
     /// \brief
     ///
     /// \param sender
-    /// \param message
+    /// \param format
+    /// \param args
     ///
     ///////////////////////////////////////////////////////////////////////////
-    static void Error(const std::string& sender, const std::string& message);
+    template <typename... Args>
+    static void Error(
+        const char* sender,
+        const char* format,
+        const Args&... args
+    );
 
     ///////////////////////////////////////////////////////////////////////////
     /// \brief
     ///
     /// \param sender
-    /// \param message
+    /// \param format
+    /// \param args
     ///
     ///////////////////////////////////////////////////////////////////////////
-    static void Debug(const std::string& sender, const std::string& message);
+    template <typename... Args>
+    static void Debug(
+        const char* sender,
+        const char* format,
+        const Args&... args
+    );
 
 private:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Claim the next slot of the calling thread's ring
+    ///
+    /// \param level
+    /// \param sender
+    ///
+    /// \return The emptied message of the slot, or nullptr if the line is
+    /// dropped
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static std::string* BeginLine(Level level, const char* sender);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Hand the slot claimed by BeginLine to the flusher
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static void EndLine(void);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Copy the format up to its next `{}`, then the value
+    ///
+    /// \param out
+    /// \param format Advanced past the placeholder
+    /// \param value Dropped if no placeholder is left
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename T>
+    static void FormatNext(
+        std::string& out,
+        std::string_view& format,
+        const T& value
+    );
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param out
+    /// \param value
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename T>
+    static void Append(std::string& out, const T& value);
+
     ///////////////////////////////////////////////////////////////////////////
     /// \brief
     ///
     /// \return
     ///
     ///////////////////////////////////////////////////////////////////////////
-    static std::string GetTimestamp(void);
+    static bool IsBinary(void);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Narrow an argument to a type binary records can hold
+    ///
+    /// \param value
+    ///
+    /// \return A bool, char, int64_t, uint64_t, double, string_view, or the
+    /// string made by ToString
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename T>
+    static auto ToBinary(const T& value);
 
     ///////////////////////////////////////////////////////////////////////////
     /// \brief
     ///
     /// \param level
+    /// \param sender
+    /// \param format
+    /// \param args Already narrowed by ToBinary
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename... Args>
+    static void LogBinary(
+        Level level,
+        const char* sender,
+        const char* format,
+        const Args&... args
+    );
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param value
+    ///
+    /// \return Bytes taken by the argument, tag included
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename T>
+    static size_t GetEncodedSize(const T& value);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param out Advanced past the argument
+    /// \param value
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename T>
+    static void Encode(char*& out, const T& value);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Id of a string literal within this process's segments
+    ///
+    /// The first use of a string writes a STRING record defining it.
+    ///
+    /// \param text
+    ///
     /// \return
     ///
     ///////////////////////////////////////////////////////////////////////////
-    static std::string LogLevelToString(Level level);
+    static uint16_t Intern(const char* text);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Claim room for a record in the current segment
+    ///
+    /// \param size Padded to 8 bytes
+    ///
+    /// \return nullptr if no segment could be opened
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static RecordHeader* ReserveRecord(size_t size);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Map the segment that follows a full one
+    ///
+    /// \param full nullptr for the first segment of the process
+    ///
+    /// \return The current segment, or nullptr on failure
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static SegmentHeader* OpenSegment(SegmentHeader* full);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Publish a record once its arguments are written
+    ///
+    /// \param record
+    /// \param size
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static void EndRecord(RecordHeader* record, size_t size);
+
+private:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Start the flusher, or flush inline once exit has stopped it
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static void StartFlusher(void);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Join the flusher after a last drain, registered with atexit
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static void StopFlusher(void);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Body of the flusher thread
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static void FlushRoutine(void);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Format every pending line and write them, with the lock held
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static void Drain(void);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Write out pending lines as they are, then die of the signal
+    ///
+    /// \param signal
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static void OnCrash(int signal);
 
     ///////////////////////////////////////////////////////////////////////////
     /// \brief
     ///
-    /// \param logMessage
+    /// \param seconds Since the epoch
     ///
+    /// \return Local time, only reformatted when the second changes
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static const char* GetTimestamp(int64_t seconds);
+
     ///////////////////////////////////////////////////////////////////////////
-    static void WriteLog(const std::string& logMessage);
+    /// \brief Write the pending batch to the file and console
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static void WriteLog(void);
 };
 
 } // !namespace Plazza
+
+///////////////////////////////////////////////////////////////////////////////
+//
+///////////////////////////////////////////////////////////////////////////////
+#include "Utils/Logger.inl"
@@ -0,0 +1,289 @@
+///////////////////////////////////////////////////////////////////////////////
+// Header guard
+///////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+///////////////////////////////////////////////////////////////////////////////
+// Dependencies
+///////////////////////////////////////////////////////////////////////////////
+#include "Utils/Logger.hpp"
+#include <algorithm>
+#include <charconv>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <type_traits>
+
+///////////////////////////////////////////////////////////////////////////////
+// Namespace Plazza
+///////////////////////////////////////////////////////////////////////////////
+namespace Plazza
+{
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename... Args>
+void Logger::Log(
+    Level level,
+    const char* sender,
+    const char* format,
+    const Args&... args
+)
+{
+    if (IsBinary())
+    {
+        LogBinary(level, sender, format, ToBinary(args)...);
+        return;
+    }
+
+    std::string* line = BeginLine(level, sender);
+
+    if (!line)
+    {
+        return;
+    }
+
+    std::string_view rest(format);
+
+    (FormatNext(*line, rest, args), ...);
+    line->append(rest);
+    EndLine();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename... Args>
+void Logger::Info(const char* sender, const char* format, const Args&... args)
+{
+    if constexpr (IsEnabled(Level::INFO))
+    {
+        Log(Level::INFO, sender, format, args...);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename... Args>
+void Logger::Warning(
+    const char* sender,
+    const char* format,
+    const Args&... args
+)
+{
+    if constexpr (IsEnabled(Level::WARNING))
+    {
+        Log(Level::WARNING, sender, format, args...);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename... Args>
+void Logger::Error(const char* sender, const char* format, const Args&... args)
+{
+    if constexpr (IsEnabled(Level::ERROR))
+    {
+        Log(Level::ERROR, sender, format, args...);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename... Args>
+void Logger::Debug(const char* sender, const char* format, const Args&... args)
+{
+    if constexpr (IsEnabled(Level::DEBUG))
+    {
+        Log(Level::DEBUG, sender, format, args...);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+void Logger::FormatNext(
+    std::string& out,
+    std::string_view& format,
+    const T& value
+)
+{
+    size_t placeholder = format.find("{}");
+
+    if (placeholder == std::string_view::npos)
+    {
+        return;
+    }
+    out.append(format.substr(0, placeholder));
+    Append(out, value);
+    format.remove_prefix(placeholder + 2);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+void Logger::Append(std::string& out, const T& value)
+{
+    if constexpr (std::is_same_v<T, bool>)
+    {
+        out += value ? "true" : "false";
+    }
+    else if constexpr (std::is_same_v<T, char>)
+    {
+        out += value;
+    }
+    else if constexpr (std::is_integral_v<T>)
+    {
+        char buffer[24];
+        auto result = std::to_chars(buffer, buffer + sizeof(buffer), value);
+
+        out.append(buffer, result.ptr);
+    }
+    else if constexpr (std::is_floating_point_v<T>)
+    {
+        char buffer[32];
+        int size = std::snprintf(buffer, sizeof(buffer), "%g",
+            static_cast<double>(value));
+
+        out.append(buffer, static_cast<size_t>(size));
+    }
+    else if constexpr (std::is_convertible_v<const T&, std::string_view>)
+    {
+        out.append(std::string_view(value));
+    }
+    else if constexpr (requires { value.ToString(); })
+    {
+        out += value.ToString();
+    }
+    else
+    {
+        static_assert(requires { value->ToString(); },
+            "Logger arguments must be numbers, strings or have ToString");
+        out += value->ToString();
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+auto Logger::ToBinary(const T& value)
+{
+    if constexpr (std::is_same_v<T, bool> || std::is_same_v<T, char>)
+    {
+        return (value);
+    }
+    else if constexpr (std::is_integral_v<T> && std::is_signed_v<T>)
+    {
+        return (static_cast<int64_t>(value));
+    }
+    else if constexpr (std::is_integral_v<T>)
+    {
+        return (static_cast<uint64_t>(value));
+    }
+    else if constexpr (std::is_floating_point_v<T>)
+    {
+        return (static_cast<double>(value));
+    }
+    else if constexpr (std::is_convertible_v<const T&, std::string_view>)
+    {
+        return (std::string_view(value));
+    }
+    else if constexpr (requires { value.ToString(); })
+    {
+        return (value.ToString());
+    }
+    else
+    {
+        return (value->ToString());
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename... Args>
+void Logger::LogBinary(
+    Level level,
+    const char* sender,
+    const char* format,
+    const Args&... args
+)
+{
+    uint16_t senderId = Intern(sender);
+    uint16_t formatId = Intern(format);
+    size_t size = (sizeof(RecordHeader) + ... + GetEncodedSize(args));
+
+    size = (size + 7) & ~static_cast<size_t>(7);
+    RecordHeader* record = ReserveRecord(size);
+    if (!record)
+    {
+        return;
+    }
+
+    record->time = std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::system_clock::now().time_since_epoch()
+    ).count();
+    record->sender = senderId;
+    record->format = formatId;
+    record->level = static_cast<uint8_t>(level);
+    record->kind = static_cast<uint8_t>(RecordKind::LINE);
+    record->argCount = static_cast<uint8_t>(sizeof...(Args));
+
+    [[maybe_unused]] char* out = reinterpret_cast<char*>(record + 1);
+    (Encode(out, args), ...);
+    EndRecord(record, size);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+size_t Logger::GetEncodedSize(const T& value)
+{
+    if constexpr (std::is_same_v<T, bool> || std::is_same_v<T, char>)
+    {
+        return (2);
+    }
+    else if constexpr (std::is_arithmetic_v<T>)
+    {
+        return (1 + sizeof(T));
+    }
+    else
+    {
+        return (3 + std::min<size_t>(value.size(), UINT16_MAX));
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+void Logger::Encode(char*& out, const T& value)
+{
+    ArgType type = ArgType::STRING;
+
+    if constexpr (std::is_same_v<T, bool>)
+    {
+        type = ArgType::BOOL;
+    }
+    else if constexpr (std::is_same_v<T, char>)
+    {
+        type = ArgType::CHAR;
+    }
+    else if constexpr (std::is_same_v<T, int64_t>)
+    {
+        type = ArgType::INT;
+    }
+    else if constexpr (std::is_same_v<T, uint64_t>)
+    {
+        type = ArgType::UINT;
+    }
+    else if constexpr (std::is_same_v<T, double>)
+    {
+        type = ArgType::DOUBLE;
+    }
+    *out++ = static_cast<char>(type);
+
+    if constexpr (std::is_arithmetic_v<T>)
+    {
+        std::memcpy(out, &value, sizeof(T));
+        out += sizeof(T);
+    }
+    else
+    {
+        uint16_t length = static_cast<uint16_t>(
+            std::min<size_t>(value.size(), UINT16_MAX)
+        );
+
+        std::memcpy(out, &length, sizeof(length));
+        std::memcpy(out + sizeof(length), value.data(), length);
+        out += sizeof(length) + length;
+    }
+}
+
+} // !namespace Plazza
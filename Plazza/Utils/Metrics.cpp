@@ -0,0 +1,240 @@
+///////////////////////////////////////////////////////////////////////////////
+// Dependencies
+///////////////////////////////////////////////////////////////////////////////
+#include "Utils/Metrics.hpp"
+#include <cstdio>
+#include <stdexcept>
+
+///////////////////////////////////////////////////////////////////////////////
+// Namespace Plazza
+///////////////////////////////////////////////////////////////////////////////
+namespace Plazza
+{
+
+///////////////////////////////////////////////////////////////////////////////
+Metrics::Counter::Counter(void)
+    : m_value(0)
+{}
+
+///////////////////////////////////////////////////////////////////////////////
+void Metrics::Counter::Increment(uint64_t amount)
+{
+    m_value.fetch_add(amount, std::memory_order_relaxed);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+uint64_t Metrics::Counter::Get(void) const
+{
+    return (m_value.load(std::memory_order_relaxed));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+Metrics::Gauge::Gauge(void)
+    : m_value(0)
+{}
+
+///////////////////////////////////////////////////////////////////////////////
+void Metrics::Gauge::Set(int64_t value)
+{
+    m_value.store(value, std::memory_order_relaxed);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void Metrics::Gauge::Add(int64_t amount)
+{
+    m_value.fetch_add(amount, std::memory_order_relaxed);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int64_t Metrics::Gauge::Get(void) const
+{
+    return (m_value.load(std::memory_order_relaxed));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+std::string Metrics::FormatLabels(
+    const std::string& labels,
+    const std::string& extra
+)
+{
+    if (labels.empty() && extra.empty())
+    {
+        return ("");
+    }
+    if (labels.empty() || extra.empty())
+    {
+        return ("{" + labels + extra + "}");
+    }
+    return ("{" + labels + "," + extra + "}");
+}
+
+///////////////////////////////////////////////////////////////////////////////
+std::string Metrics::FormatValue(double value)
+{
+    char buffer[32];
+
+    std::snprintf(buffer, sizeof(buffer), "%.9g", value);
+    return (buffer);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+std::string Metrics::JoinLabels(const Labels& labels)
+{
+    std::string key;
+
+    for (const auto& [label, value] : labels)
+    {
+        key += (key.empty() ? "" : ",") + label + "=\"" + value + "\"";
+    }
+
+    return (key);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+Metrics::Series& Metrics::GetSeries(
+    const std::string& name,
+    const std::string& help,
+    Type type,
+    const Labels& labels,
+    double unit
+)
+{
+    auto [family, created] = m_families.try_emplace(
+        name, Family{type, help, unit, {}}
+    );
+    if (!created && family->second.type != type)
+    {
+        throw std::logic_error("Metric " + name + " registered twice");
+    }
+
+    Series& series = family->second.series[JoinLabels(labels)];
+    if (!series.counter && !series.gauge && !series.histogram)
+    {
+        if (type == Type::COUNTER)
+        {
+            series.counter = std::make_unique<Counter>();
+        }
+        else if (type == Type::GAUGE)
+        {
+            series.gauge = std::make_unique<Gauge>();
+        }
+        else
+        {
+            series.histogram = std::make_unique<Histogram>();
+        }
+    }
+    return (series);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+Metrics::Counter& Metrics::GetCounter(
+    const std::string& name,
+    const std::string& help,
+    const Labels& labels
+)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    return (*GetSeries(name, help, Type::COUNTER, labels).counter);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+Metrics::Gauge& Metrics::GetGauge(
+    const std::string& name,
+    const std::string& help,
+    const Labels& labels
+)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    return (*GetSeries(name, help, Type::GAUGE, labels).gauge);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+Histogram& Metrics::GetHistogram(
+    const std::string& name,
+    const std::string& help,
+    double unit,
+    const Labels& labels
+)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    return (*GetSeries(name, help, Type::HISTOGRAM, labels, unit).histogram);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void Metrics::Remove(const std::string& name, const Labels& labels)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto family = m_families.find(name);
+
+    if (family != m_families.end())
+    {
+        family->second.series.erase(JoinLabels(labels));
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+std::string Metrics::Render(void) const
+{
+    static const char* TYPE_NAMES[] = {"counter", "gauge", "histogram"};
+    std::lock_guard<std::mutex> lock(m_mutex);
+    std::string out;
+
+    for (const auto& [name, family] : m_families)
+    {
+        if (family.series.empty())
+        {
+            continue;
+        }
+
+        out += "# HELP " + name + " " + family.help + "\n";
+        out += "# TYPE " + name + " " +
+            TYPE_NAMES[static_cast<size_t>(family.type)] + "\n";
+
+        for (const auto& [labels, series] : family.series)
+        {
+            if (series.counter)
+            {
+                out += name + FormatLabels(labels) + " " +
+                    std::to_string(series.counter->Get()) + "\n";
+                continue;
+            }
+            if (series.gauge)
+            {
+                out += name + FormatLabels(labels) + " " +
+                    std::to_string(series.gauge->Get()) + "\n";
+                continue;
+            }
+
+            // Samples count in the first bound their whole bucket fits
+            // under, so a bound may under-count by one bucket width (~6%).
+            Histogram::Snapshot snapshot = series.histogram->Read();
+            uint64_t cumulative = 0;
+            size_t index = 0;
+
+            for (double bound : BUCKET_BOUNDS)
+            {
+                while (index < Histogram::BUCKET_COUNT &&
+                    Histogram::GetBucketValue(index) * family.unit <= bound)
+                {
+                    cumulative += snapshot.buckets[index++];
+                }
+                out += name + "_bucket" + FormatLabels(
+                    labels, "le=\"" + FormatValue(bound) + "\""
+                ) + " " + std::to_string(cumulative) + "\n";
+            }
+            out += name + "_bucket" + FormatLabels(labels, "le=\"+Inf\"") +
+                " " + std::to_string(snapshot.count) + "\n";
+            out += name + "_sum" + FormatLabels(labels) + " " +
+                FormatValue(snapshot.sum * family.unit) + "\n";
+            out += name + "_count" + FormatLabels(labels) + " " +
+                std::to_string(snapshot.count) + "\n";
+        }
+    }
+
+    return (out);
+}
+
+} // !namespace Plazza
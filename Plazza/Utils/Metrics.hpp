@@ -0,0 +1,301 @@
+///////////////////////////////////////////////////////////////////////////////
+// Header guard
+///////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+///////////////////////////////////////////////////////////////////////////////
+// Dependencies
+///////////////////////////////////////////////////////////////////////////////
+#include "Utils/Singleton.hpp"
+#include "Utils/Histogram.hpp"
+#include "Concurrency/Mutex.hpp"
+#include <atomic>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+// Namespace Plazza
+///////////////////////////////////////////////////////////////////////////////
+namespace Plazza
+{
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Process-wide registry of counters, gauges and histograms
+///
+/// Looking a series up takes a lock, so hot paths keep the returned
+/// reference. Render writes the Prometheus text exposition format.
+///
+///////////////////////////////////////////////////////////////////////////////
+class Metrics : public Singleton<Metrics>
+{
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    //
+    ///////////////////////////////////////////////////////////////////////////
+    using Labels = std::vector<std::pair<std::string, std::string>>;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Monotonic count
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    class Counter
+    {
+    private:
+        std::atomic<uint64_t> m_value;  //<!
+
+    public:
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief
+        ///
+        ///////////////////////////////////////////////////////////////////////
+        Counter(void);
+
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief
+        ///
+        /// \param amount
+        ///
+        ///////////////////////////////////////////////////////////////////////
+        void Increment(uint64_t amount = 1);
+
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief
+        ///
+        /// \return
+        ///
+        ///////////////////////////////////////////////////////////////////////
+        uint64_t Get(void) const;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Value that goes up and down
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    class Gauge
+    {
+    private:
+        std::atomic<int64_t> m_value;   //<!
+
+    public:
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief
+        ///
+        ///////////////////////////////////////////////////////////////////////
+        Gauge(void);
+
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief
+        ///
+        /// \param value
+        ///
+        ///////////////////////////////////////////////////////////////////////
+        void Set(int64_t value);
+
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief
+        ///
+        /// \param amount Negative to decrease
+        ///
+        ///////////////////////////////////////////////////////////////////////
+        void Add(int64_t amount);
+
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief
+        ///
+        /// \return
+        ///
+        ///////////////////////////////////////////////////////////////////////
+        int64_t Get(void) const;
+    };
+
+private:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    enum class Type
+    {
+        COUNTER,
+        GAUGE,
+        HISTOGRAM
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief One labelled value of a family
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    struct Series
+    {
+        std::unique_ptr<Counter> counter;       //<!
+        std::unique_ptr<Gauge> gauge;           //<!
+        std::unique_ptr<Histogram> histogram;   //<!
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Every series sharing a metric name
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    struct Family
+    {
+        Type type;                                  //<!
+        std::string help;                           //<!
+        double unit;                                //<! Histogram value scale
+        std::map<std::string, Series> series;       //<! By formatted labels
+    };
+
+private:
+    ///////////////////////////////////////////////////////////////////////////
+    //
+    ///////////////////////////////////////////////////////////////////////////
+    std::map<std::string, Family> m_families;   //<!
+    mutable Mutex m_mutex;                      //<!
+
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Upper bounds of exported histogram buckets, in seconds
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static constexpr double BUCKET_BOUNDS[] = {
+        0.0005, 0.001, 0.0025, 0.005, 0.01, 0.025, 0.05,
+        0.1, 0.25, 0.5, 1.0, 2.5, 5.0, 10.0, 30.0
+    };
+
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    Metrics(void) = default;
+
+private:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Find or create a series, checking the family type
+    ///
+    /// \param name
+    /// \param help
+    /// \param type
+    /// \param labels
+    /// \param unit
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    Series& GetSeries(
+        const std::string& name,
+        const std::string& help,
+        Type type,
+        const Labels& labels,
+        double unit = 1.0
+    );
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param labels
+    /// \param extra Appended last, as for the le label of buckets
+    ///
+    /// \return `{a="1",b="2"}`, or an empty string without labels
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static std::string FormatLabels(
+        const std::string& labels,
+        const std::string& extra = ""
+    );
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param value
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static std::string FormatValue(double value);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param labels
+    ///
+    /// \return `a="1",b="2"`, the key of a series within its family
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static std::string JoinLabels(const Labels& labels);
+
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param name
+    /// \param help
+    /// \param labels
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    Counter& GetCounter(
+        const std::string& name,
+        const std::string& help,
+        const Labels& labels = {}
+    );
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param name
+    /// \param help
+    /// \param labels
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    Gauge& GetGauge(
+        const std::string& name,
+        const std::string& help,
+        const Labels& labels = {}
+    );
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param name
+    /// \param help
+    /// \param unit Seconds per recorded unit, 1e-6 for microseconds
+    /// \param labels
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    Histogram& GetHistogram(
+        const std::string& name,
+        const std::string& help,
+        double unit,
+        const Labels& labels = {}
+    );
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Drop a series, such as the gauges of a gone kitchen
+    ///
+    /// References to it die with it, so only remove series that are
+    /// looked up again on every use.
+    ///
+    /// \param name
+    /// \param labels
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void Remove(const std::string& name, const Labels& labels);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \return Every series in the text exposition format
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    std::string Render(void) const;
+};
+
+} // !namespace Plazza
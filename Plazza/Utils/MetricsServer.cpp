@@ -0,0 +1,180 @@
+///////////////////////////////////////////////////////////////////////////////
+// Dependencies
+///////////////////////////////////////////////////////////////////////////////
+#include "Utils/MetricsServer.hpp"
+#include "Utils/Metrics.hpp"
+#include "Utils/Logger.hpp"
+#include <arpa/inet.h>
+#include <cstring>
+#include <netinet/in.h>
+#include <poll.h>
+#include <stdexcept>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+///////////////////////////////////////////////////////////////////////////////
+// Namespace Plazza
+///////////////////////////////////////////////////////////////////////////////
+namespace Plazza
+{
+
+///////////////////////////////////////////////////////////////////////////////
+MetricsServer::MetricsServer(uint16_t port)
+    : m_socket(socket(AF_INET, SOCK_STREAM | SOCK_CLOEXEC, 0))
+    , m_thread(std::bind(&MetricsServer::Routine, this))
+{
+    struct sockaddr_in address{};
+    int reuse = 1;
+
+    address.sin_family = AF_INET;
+    address.sin_port = htons(port);
+    address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+
+    if (m_socket == -1
+        || setsockopt(m_socket, SOL_SOCKET, SO_REUSEADDR, &reuse, sizeof(reuse))
+        || bind(m_socket, reinterpret_cast<sockaddr*>(&address), sizeof(address))
+        || listen(m_socket, 16))
+    {
+        std::string error = strerror(errno);
+        if (m_socket != -1)
+        {
+            close(m_socket);
+        }
+        throw std::runtime_error(
+            "Failed to serve metrics on port " + std::to_string(port) +
+            ": " + error
+        );
+    }
+
+    m_thread.Start();
+    Logger::Info("METRICS", "Serving http://127.0.0.1:{}/metrics", port);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+MetricsServer::MetricsServer(const std::string& socketPath)
+    : m_socket(socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0))
+    , m_socketPath(socketPath)
+    , m_thread(std::bind(&MetricsServer::Routine, this))
+{
+    struct sockaddr_un address{};
+
+    address.sun_family = AF_UNIX;
+    if (socketPath.size() >= sizeof(address.sun_path))
+    {
+        close(m_socket);
+        throw std::runtime_error("Metrics socket path too long: " + socketPath);
+    }
+    std::strcpy(address.sun_path, socketPath.c_str());
+    unlink(socketPath.c_str());
+
+    if (m_socket == -1
+        || bind(m_socket, reinterpret_cast<sockaddr*>(&address), sizeof(address))
+        || listen(m_socket, 16))
+    {
+        std::string error = strerror(errno);
+        if (m_socket != -1)
+        {
+            close(m_socket);
+        }
+        throw std::runtime_error(
+            "Failed to serve metrics on " + socketPath + ": " + error
+        );
+    }
+
+    m_thread.Start();
+    Logger::Info("METRICS", "Serving metrics on {}", socketPath);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+MetricsServer::~MetricsServer()
+{
+    m_thread.running = false;
+    if (m_thread.Joinable())
+    {
+        m_thread.Join();
+    }
+    close(m_socket);
+    if (!m_socketPath.empty())
+    {
+        unlink(m_socketPath.c_str());
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void MetricsServer::Routine(void)
+{
+    while (m_thread.running)
+    {
+        struct pollfd fd = {m_socket, POLLIN, 0};
+
+        if (poll(&fd, 1, 200) <= 0)
+        {
+            continue;
+        }
+
+        int client = accept4(m_socket, nullptr, nullptr, SOCK_CLOEXEC);
+        if (client == -1)
+        {
+            continue;
+        }
+        Serve(client);
+        close(client);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void MetricsServer::Serve(int client)
+{
+    std::string request;
+    char buffer[1024];
+
+    // A slow or silent client must not hold the only serving thread.
+    struct timeval timeout = {1, 0};
+    setsockopt(client, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+
+    while (request.find("\r\n\r\n") == std::string::npos
+        && request.size() < 8192)
+    {
+        ssize_t count = read(client, buffer, sizeof(buffer));
+        if (count <= 0)
+        {
+            return;
+        }
+        request.append(buffer, static_cast<size_t>(count));
+    }
+
+    std::string status = "200 OK";
+    std::string body;
+
+    if (request.rfind("GET /metrics ", 0) == 0)
+    {
+        body = Metrics::GetInstance().Render();
+    }
+    else
+    {
+        status = "404 Not Found";
+        body = "Only GET /metrics is served\n";
+    }
+
+    std::string response =
+        "HTTP/1.1 " + status + "\r\n"
+        "Content-Type: text/plain; version=0.0.4; charset=utf-8\r\n"
+        "Content-Length: " + std::to_string(body.size()) + "\r\n"
+        "Connection: close\r\n\r\n" + body;
+
+    const char* data = response.data();
+    size_t size = response.size();
+    while (size > 0)
+    {
+        ssize_t written = send(client, data, size, MSG_NOSIGNAL);
+        if (written <= 0)
+        {
+            return;
+        }
+        data += written;
+        size -= static_cast<size_t>(written);
+    }
+}
+
+} // !namespace Plazza
@@ -0,0 +1,76 @@
+///////////////////////////////////////////////////////////////////////////////
+// Header guard
+///////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+///////////////////////////////////////////////////////////////////////////////
+// Dependencies
+///////////////////////////////////////////////////////////////////////////////
+#include "Concurrency/Thread.hpp"
+#include <cstdint>
+#include <string>
+
+///////////////////////////////////////////////////////////////////////////////
+// Namespace Plazza
+///////////////////////////////////////////////////////////////////////////////
+namespace Plazza
+{
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Minimal HTTP/1.1 listener serving the Metrics registry
+///
+/// Answers `GET /metrics` with the Prometheus text format and closes every
+/// connection after one response. Only ever binds to 127.0.0.1 or to a
+/// Unix socket, and serves one scrape at a time on its own thread.
+///
+///////////////////////////////////////////////////////////////////////////////
+class MetricsServer
+{
+private:
+    ///////////////////////////////////////////////////////////////////////////
+    //
+    ///////////////////////////////////////////////////////////////////////////
+    int m_socket;                       //<!
+    std::string m_socketPath;           //<! Empty for TCP
+    Thread m_thread;                    //<!
+
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Listen on 127.0.0.1
+    ///
+    /// \param port
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    explicit MetricsServer(uint16_t port);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Listen on a Unix socket, replacing any stale one
+    ///
+    /// \param socketPath
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    explicit MetricsServer(const std::string& socketPath);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    ~MetricsServer();
+
+private:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void Routine(void);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Read one request and write its response
+    ///
+    /// \param client
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static void Serve(int client);
+};
+
+} // !namespace Plazza
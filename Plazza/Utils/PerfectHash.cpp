@@ -0,0 +1,144 @@
+///////////////////////////////////////////////////////////////////////////////
+// Dependencies
+///////////////////////////////////////////////////////////////////////////////
+#include "Utils/PerfectHash.hpp"
+#include "Errors/InvalidArgument.hpp"
+#include <algorithm>
+#include <bit>
+
+///////////////////////////////////////////////////////////////////////////////
+// Namespace Plazza
+///////////////////////////////////////////////////////////////////////////////
+namespace Plazza
+{
+
+///////////////////////////////////////////////////////////////////////////////
+PerfectHash::PerfectHash(void)
+    : m_displacements(1, 0)
+    , m_slots(1, NOT_FOUND)
+    , m_mask(0)
+{}
+
+///////////////////////////////////////////////////////////////////////////////
+PerfectHash::PerfectHash(std::vector<std::string> keys)
+    : m_keys(std::move(keys))
+{
+    std::vector<std::string_view> sorted(m_keys.begin(), m_keys.end());
+
+    std::sort(sorted.begin(), sorted.end());
+    auto twice = std::adjacent_find(sorted.begin(), sorted.end());
+    if (twice != sorted.end())
+    {
+        throw InvalidArgument("Duplicate key '" + std::string(*twice) + "'");
+    }
+
+    size_t size = std::bit_ceil(std::max<size_t>(m_keys.size(), 1));
+    std::vector<uint64_t> hashes(m_keys.size());
+    std::vector<std::vector<uint32_t>> buckets(size);
+
+    m_mask = size - 1;
+    m_displacements.assign(size, 0);
+    m_slots.assign(size, NOT_FOUND);
+    for (uint32_t i = 0; i < m_keys.size(); i++)
+    {
+        hashes[i] = Hash(m_keys[i]);
+        buckets[(hashes[i] >> 32) & m_mask].push_back(i);
+    }
+
+    // Crowded buckets first, while most slots are still free
+    std::vector<uint32_t> order(size);
+    for (uint32_t i = 0; i < size; i++)
+    {
+        order[i] = i;
+    }
+    std::stable_sort(order.begin(), order.end(), [&](uint32_t a, uint32_t b) {
+        return (buckets[a].size() > buckets[b].size());
+    });
+
+    std::vector<uint64_t> taken;
+    for (uint32_t bucket : order)
+    {
+        if (buckets[bucket].empty())
+        {
+            break;
+        }
+
+        uint32_t displacement = 0;
+        for (; displacement < MAX_ATTEMPTS; displacement++)
+        {
+            taken.clear();
+            for (uint32_t key : buckets[bucket])
+            {
+                uint64_t slot = Displace(hashes[key], displacement) & m_mask;
+
+                if (m_slots[slot] != NOT_FOUND ||
+                    std::find(taken.begin(), taken.end(), slot) != taken.end())
+                {
+                    break;
+                }
+                taken.push_back(slot);
+            }
+            if (taken.size() == buckets[bucket].size())
+            {
+                break;
+            }
+        }
+        if (displacement == MAX_ATTEMPTS)
+        {
+            throw InvalidArgument("No perfect hash found for these keys");
+        }
+
+        m_displacements[bucket] = displacement;
+        for (size_t i = 0; i < taken.size(); i++)
+        {
+            m_slots[taken[i]] = buckets[bucket][i];
+        }
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+uint64_t PerfectHash::Hash(std::string_view key)
+{
+    uint64_t hash = 0xCBF29CE484222325;
+
+    for (char c : key)
+    {
+        hash = (hash ^ static_cast<unsigned char>(c)) * 0x100000001B3;
+    }
+    hash ^= hash >> 33;
+    hash *= 0xFF51AFD7ED558CCD;
+    hash ^= hash >> 33;
+    return (hash);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+uint64_t PerfectHash::Displace(uint64_t hash, uint32_t displacement)
+{
+    hash += (displacement + 1ull) * 0x9E3779B97F4A7C15;
+    hash ^= hash >> 33;
+    hash *= 0xC4CEB9FE1A85EC53;
+    hash ^= hash >> 33;
+    return (hash);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+uint32_t PerfectHash::Find(std::string_view key) const
+{
+    uint64_t hash = Hash(key);
+    uint32_t displacement = m_displacements[(hash >> 32) & m_mask];
+    uint32_t index = m_slots[Displace(hash, displacement) & m_mask];
+
+    if (index == NOT_FOUND || m_keys[index] != key)
+    {
+        return (NOT_FOUND);
+    }
+    return (index);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+const std::vector<std::string>& PerfectHash::GetKeys(void) const
+{
+    return (m_keys);
+}
+
+} // !namespace Plazza
@@ -0,0 +1,105 @@
+///////////////////////////////////////////////////////////////////////////////
+// Header guard
+///////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+///////////////////////////////////////////////////////////////////////////////
+// Dependencies
+///////////////////////////////////////////////////////////////////////////////
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+// Namespace Plazza
+///////////////////////////////////////////////////////////////////////////////
+namespace Plazza
+{
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Perfect hash of a fixed set of names, built once, read-only after
+///
+/// Hash and displace: a key's hash picks a bucket, and the displacement
+/// stored for that bucket, searched at build time, sends it to a slot no
+/// other key uses. A lookup hashes the key once, reads two arrays and
+/// compares one string, without locking or allocating.
+///
+///////////////////////////////////////////////////////////////////////////////
+class PerfectHash
+{
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    //
+    ///////////////////////////////////////////////////////////////////////////
+    static constexpr uint32_t NOT_FOUND = UINT32_MAX;
+    static constexpr uint32_t MAX_ATTEMPTS = 1u << 20;
+
+private:
+    ///////////////////////////////////////////////////////////////////////////
+    //
+    ///////////////////////////////////////////////////////////////////////////
+    std::vector<std::string> m_keys;            //<! In insertion order
+    std::vector<uint32_t> m_displacements;      //<! By bucket
+    std::vector<uint32_t> m_slots;              //<! Key index, by slot
+    uint64_t m_mask;                            //<! Buckets and slots - 1
+
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Empty set, every lookup fails
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    PerfectHash(void);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param keys Throws InvalidArgument if one appears twice
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    explicit PerfectHash(std::vector<std::string> keys);
+
+private:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief FNV-1a, finished with a 64-bit mixer
+    ///
+    /// \param key
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static uint64_t Hash(std::string_view key);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param hash
+    /// \param displacement
+    ///
+    /// \return Slot of a key of that hash, before masking
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static uint64_t Displace(uint64_t hash, uint32_t displacement);
+
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param key
+    ///
+    /// \return Index of the key in the build order, or NOT_FOUND
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    uint32_t Find(std::string_view key) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \return The keys, in the build order
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    const std::vector<std::string>& GetKeys(void) const;
+};
+
+} // !namespace Plazza
@@ -34,5 +34,21 @@ int64_t SteadyClock::DurationToMs(Duration duration)
     return (milliseconds);
 }
 
+///////////////////////////////////////////////////////////////////////////////
+int64_t SteadyClock::ToNs(TimePoint time)
+{
+    return (std::chrono::duration_cast<std::chrono::nanoseconds>(
+        time.time_since_epoch()
+    ).count());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+TimePoint SteadyClock::FromNs(int64_t ns)
+{
+    return (TimePoint(std::chrono::duration_cast<TimePoint::duration>(
+        std::chrono::nanoseconds(ns)
+    )));
+}
+
 
 } // Plazza
@@ -72,6 +72,29 @@ public:
     ///
     ///////////////////////////////////////////////////////////////////////////
     static int64_t DurationToMs(Duration duration);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Flatten a time point so it can cross a process boundary
+    ///
+    /// The steady clock is CLOCK_MONOTONIC, shared by every process on the
+    /// machine, so values from a kitchen compare with the Reception's.
+    ///
+    /// \param time
+    ///
+    /// \return Nanoseconds since the clock's epoch
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static int64_t ToNs(TimePoint time);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param ns
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static TimePoint FromNs(int64_t ns);
 };
 
 } // Plazza
@@ -0,0 +1,190 @@
+///////////////////////////////////////////////////////////////////////////////
+// Dependencies
+///////////////////////////////////////////////////////////////////////////////
+#include "Utils/Tracer.hpp"
+#include <fcntl.h>
+#include <filesystem>
+#include <pthread.h>
+#include <unistd.h>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+// Namespace Plazza
+///////////////////////////////////////////////////////////////////////////////
+namespace Plazza
+{
+
+///////////////////////////////////////////////////////////////////////////////
+// Static member initialization
+///////////////////////////////////////////////////////////////////////////////
+std::atomic<bool> Tracer::s_enabled(false);
+std::string Tracer::s_directory;
+Tracer::Role Tracer::s_role = Tracer::Role::RECEPTION;
+uint32_t Tracer::s_kitchen = 0;
+
+///////////////////////////////////////////////////////////////////////////////
+// Per-thread record buffer
+///////////////////////////////////////////////////////////////////////////////
+namespace
+{
+
+constexpr size_t BUFFER_CAPACITY = 4096;
+
+struct Buffer
+{
+    std::vector<Tracer::Record> records;
+    uint32_t pid = static_cast<uint32_t>(getpid());
+    uint32_t tid = static_cast<uint32_t>(gettid());
+
+    Buffer(void)
+    {
+        records.reserve(BUFFER_CAPACITY);
+    }
+
+    ~Buffer()
+    {
+        Tracer::Flush();
+    }
+};
+
+thread_local Buffer t_buffer;
+
+}
+
+///////////////////////////////////////////////////////////////////////////////
+Tracer::Scope::Scope(Event event, uint64_t arg0, uint64_t arg1)
+    : m_event(event)
+    , m_begin(IsEnabled() ? SteadyClock::Now() : TimePoint())
+    , arg0(arg0)
+    , arg1(arg1)
+{}
+
+///////////////////////////////////////////////////////////////////////////////
+Tracer::Scope::~Scope()
+{
+    if (IsEnabled())
+    {
+        Trace(m_event, m_begin, SteadyClock::Now(), arg0, arg1);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void Tracer::Enable(const std::string& directory)
+{
+    std::filesystem::create_directories(directory);
+    s_directory = directory;
+
+    // The forking thread's records belong to the parent, which flushes them.
+    static bool registered = false;
+    if (!registered)
+    {
+        pthread_atfork(nullptr, nullptr, []() {
+            t_buffer.records.clear();
+            t_buffer.pid = static_cast<uint32_t>(getpid());
+            t_buffer.tid = static_cast<uint32_t>(gettid());
+        });
+        registered = true;
+    }
+
+    s_enabled = true;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+bool Tracer::IsEnabled(void)
+{
+    return (s_enabled.load(std::memory_order_relaxed));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void Tracer::SetRole(Role role, size_t kitchen)
+{
+    s_role = role;
+    s_kitchen = static_cast<uint32_t>(kitchen);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void Tracer::Trace(
+    Event event,
+    TimePoint begin,
+    TimePoint end,
+    uint64_t arg0,
+    uint64_t arg1
+)
+{
+    if (!IsEnabled())
+    {
+        return;
+    }
+
+    Buffer& buffer = t_buffer;
+
+    buffer.records.push_back({
+        SteadyClock::ToNs(begin), SteadyClock::ToNs(end), arg0, arg1,
+        buffer.pid, buffer.tid, s_kitchen,
+        static_cast<uint16_t>(event), static_cast<uint16_t>(s_role)
+    });
+
+    if (buffer.records.size() >= BUFFER_CAPACITY)
+    {
+        Flush();
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void Tracer::Flush(void)
+{
+    if (!IsEnabled())
+    {
+        return;
+    }
+
+    Buffer& buffer = t_buffer;
+
+    if (buffer.records.empty())
+    {
+        return;
+    }
+
+    std::string path = s_directory + "/" + std::to_string(buffer.pid) + "-" +
+        std::to_string(buffer.tid) + ".trace";
+    int fd = open(path.c_str(), O_WRONLY | O_CREAT | O_APPEND, 0644);
+
+    if (fd != -1)
+    {
+        const char* data = reinterpret_cast<const char*>(buffer.records.data());
+        size_t size = buffer.records.size() * sizeof(Record);
+
+        while (size > 0)
+        {
+            ssize_t written = write(fd, data, size);
+            if (written <= 0)
+            {
+                break;
+            }
+            data += written;
+            size -= static_cast<size_t>(written);
+        }
+        close(fd);
+    }
+
+    buffer.records.clear();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+const char* Tracer::GetEventName(Event event)
+{
+    switch (event)
+    {
+        case Event::ORDER_PARSE: return ("Order parse");
+        case Event::DISPATCH: return ("Dispatch");
+        case Event::IPC_SEND: return ("IPC send");
+        case Event::IPC_RECEIVE: return ("IPC receive");
+        case Event::QUEUE_WAIT: return ("Queue wait");
+        case Event::INGREDIENT_WAIT: return ("Ingredient wait");
+        case Event::COOK: return ("Cook");
+        case Event::STATUS_SEND: return ("Status send");
+        default: return ("Unknown");
+    }
+}
+
+} // !namespace Plazza
@@ -0,0 +1,182 @@
+///////////////////////////////////////////////////////////////////////////////
+// Header guard
+///////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+///////////////////////////////////////////////////////////////////////////////
+// Dependencies
+///////////////////////////////////////////////////////////////////////////////
+#include "Utils/Timer.hpp"
+#include <atomic>
+#include <cstdint>
+#include <string>
+
+///////////////////////////////////////////////////////////////////////////////
+// Namespace Plazza
+///////////////////////////////////////////////////////////////////////////////
+namespace Plazza
+{
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Optional binary trace of the pizza lifecycle, across processes
+///
+/// Each thread appends fixed-size records to its own buffer and writes it to
+/// `<directory>/<pid>-<tid>.trace` when full and when the thread ends, so
+/// tracing takes no lock. Forked children drop what they inherited. The
+/// plazza-trace tool merges the files into a Chrome trace JSON timeline.
+///
+///////////////////////////////////////////////////////////////////////////////
+class Tracer
+{
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief What a trace record measures
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    enum class Event : uint16_t
+    {
+        ORDER_PARSE,        //<! arg0: pizza count
+        DISPATCH,           //<! arg0: order, arg1: sequence << 32 | kitchen
+        IPC_SEND,           //<! arg0: message type, arg1: bytes
+        IPC_RECEIVE,        //<! arg0: message type, arg1: bytes
+        QUEUE_WAIT,         //<! arg0: order, arg1: sequence
+        INGREDIENT_WAIT,    //<! arg0: order, arg1: sequence
+        COOK,               //<! arg0: order, arg1: sequence
+        STATUS_SEND,        //<! arg0: queued pizzas
+        COUNT
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Which process wrote a record
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    enum class Role : uint16_t
+    {
+        RECEPTION,
+        ZYGOTE,
+        KITCHEN
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief One span as written to the trace files
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    struct Record
+    {
+        int64_t begin;      //<! Steady clock, in nanoseconds
+        int64_t end;        //<! Steady clock, in nanoseconds
+        uint64_t arg0;      //<!
+        uint64_t arg1;      //<!
+        uint32_t pid;       //<!
+        uint32_t tid;       //<!
+        uint32_t kitchen;   //<! Kitchen id, if role is KITCHEN
+        uint16_t event;     //<!
+        uint16_t role;      //<!
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Measure the lifetime of a scope as one record
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    class Scope
+    {
+    private:
+        Event m_event;      //<!
+        TimePoint m_begin;  //<!
+
+    public:
+        uint64_t arg0;      //<! May be set before the scope ends
+        uint64_t arg1;      //<!
+
+    public:
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief
+        ///
+        /// \param event
+        /// \param arg0
+        /// \param arg1
+        ///
+        ///////////////////////////////////////////////////////////////////////
+        Scope(Event event, uint64_t arg0 = 0, uint64_t arg1 = 0);
+
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief
+        ///
+        ///////////////////////////////////////////////////////////////////////
+        ~Scope();
+    };
+
+private:
+    ///////////////////////////////////////////////////////////////////////////
+    //
+    ///////////////////////////////////////////////////////////////////////////
+    static std::atomic<bool> s_enabled;     //<!
+    static std::string s_directory;         //<!
+    static Role s_role;                     //<!
+    static uint32_t s_kitchen;              //<!
+
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Start tracing into a directory, before any process is forked
+    ///
+    /// \param directory Created if missing
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static void Enable(const std::string& directory);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static bool IsEnabled(void);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Tag every later record of this process
+    ///
+    /// \param role
+    /// \param kitchen
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static void SetRole(Role role, size_t kitchen = 0);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Append a span to the calling thread's buffer
+    ///
+    /// \param event
+    /// \param begin
+    /// \param end
+    /// \param arg0
+    /// \param arg1
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static void Trace(
+        Event event,
+        TimePoint begin,
+        TimePoint end,
+        uint64_t arg0 = 0,
+        uint64_t arg1 = 0
+    );
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Write the calling thread's buffer out now
+    ///
+    /// Threads flush on their own when they end; a process leaving through
+    /// _exit must call this on its main thread first.
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static void Flush(void);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param event
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static const char* GetEventName(Event event);
+};
+
+} // !namespace Plazza
@@ -0,0 +1,111 @@
+///////////////////////////////////////////////////////////////////////////////
+// Dependencies
+///////////////////////////////////////////////////////////////////////////////
+#include "Utils/Histogram.hpp"
+#include <criterion/criterion.h>
+#include <memory>
+#include <thread>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+using namespace Plazza;
+
+///////////////////////////////////////////////////////////////////////////////
+// Test Suite for Histogram
+///////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////////
+Test(Histogram, small_values_are_exact)
+{
+    for (uint64_t value = 0; value < Histogram::SUB_BUCKET_COUNT; value++)
+    {
+        size_t index = Histogram::GetBucketIndex(value);
+
+        cr_assert_eq(Histogram::GetBucketValue(index), value);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+Test(Histogram, buckets_cover_values_in_order)
+{
+    size_t previous = 0;
+
+    for (uint64_t value = 1; value < (1ULL << 20); value += value / 7 + 1)
+    {
+        size_t index = Histogram::GetBucketIndex(value);
+
+        cr_assert_geq(index, previous, "Buckets should grow with values");
+        cr_assert_geq(Histogram::GetBucketValue(index), value);
+        cr_assert_leq(Histogram::GetBucketValue(index) - value, value / 16);
+        previous = index;
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+Test(Histogram, huge_values_land_in_last_bucket)
+{
+    cr_assert_eq(
+        Histogram::GetBucketIndex(UINT64_MAX),
+        Histogram::BUCKET_COUNT - 1
+    );
+    cr_assert_eq(
+        Histogram::GetBucketIndex((1ULL << Histogram::MAX_VALUE_BITS) - 1),
+        Histogram::BUCKET_COUNT - 1
+    );
+}
+
+///////////////////////////////////////////////////////////////////////////////
+Test(Histogram, percentiles)
+{
+    auto histogram = std::make_unique<Histogram>();
+
+    for (uint64_t value = 1; value <= 1000; value++)
+    {
+        histogram->Record(value);
+    }
+
+    Histogram::Snapshot snapshot = histogram->Read();
+
+    cr_assert_eq(snapshot.count, 1000);
+    cr_assert_eq(snapshot.max, 1000);
+    cr_assert_eq(snapshot.sum, 500500);
+    cr_assert_geq(snapshot.ValueAt(50.0), 500);
+    cr_assert_leq(snapshot.ValueAt(50.0), 500 + 500 / 16);
+    cr_assert_geq(snapshot.ValueAt(99.0), 990);
+    cr_assert_eq(snapshot.ValueAt(100.0), 1000);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+Test(Histogram, empty_snapshot)
+{
+    auto histogram = std::make_unique<Histogram>();
+
+    cr_assert_eq(histogram->Read().count, 0);
+    cr_assert_eq(histogram->Read().ValueAt(99.0), 0);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+Test(Histogram, concurrent_recording)
+{
+    auto histogram = std::make_unique<Histogram>();
+    std::vector<std::thread> threads;
+
+    for (uint64_t t = 0; t < 12; t++)
+    {
+        threads.emplace_back([&histogram, t]() {
+            for (uint64_t i = 0; i < 10000; i++)
+            {
+                histogram->Record(t * 100 + i % 100);
+            }
+        });
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    Histogram::Snapshot snapshot = histogram->Read();
+
+    cr_assert_eq(snapshot.count, 120000);
+    cr_assert_eq(snapshot.max, 1199);
+}
@@ -0,0 +1,106 @@
+///////////////////////////////////////////////////////////////////////////////
+// Dependencies
+///////////////////////////////////////////////////////////////////////////////
+#include "Utils/Logger.hpp"
+#include <criterion/criterion.h>
+#include <fstream>
+#include <string>
+#include <thread>
+#include <unistd.h>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+using namespace Plazza;
+
+///////////////////////////////////////////////////////////////////////////////
+// Test Suite for Logger
+///////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////////
+static std::vector<std::string> ReadLines(const std::string& path)
+{
+    std::ifstream file(path);
+    std::vector<std::string> lines;
+    std::string line;
+
+    while (std::getline(file, line))
+    {
+        lines.push_back(line);
+    }
+    return (lines);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+Test(Logger, flush_writes_lines_in_order)
+{
+    std::string path = "/tmp/plazza_logger_test_" +
+        std::to_string(getpid()) + ".log";
+
+    unlink(path.c_str());
+    Logger::SetConsoleOutput(false);
+    Logger::SetLogFile(path);
+
+    for (int i = 0; i < 100; i++)
+    {
+        Logger::Info("TEST", "line {}", i);
+    }
+    Logger::Flush();
+
+    std::vector<std::string> lines = ReadLines(path);
+    cr_assert_eq(lines.size(), 100u);
+    cr_assert(lines.front().ends_with("[INFO] [TEST] line 0"));
+    cr_assert(lines.back().ends_with("[INFO] [TEST] line 99"));
+    unlink(path.c_str());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+Test(Logger, lines_of_ended_threads_are_kept)
+{
+    std::string path = "/tmp/plazza_logger_test_threads_" +
+        std::to_string(getpid()) + ".log";
+    std::vector<std::thread> threads;
+
+    unlink(path.c_str());
+    Logger::SetConsoleOutput(false);
+    Logger::SetLogFile(path);
+
+    for (int t = 0; t < 4; t++)
+    {
+        threads.emplace_back([t]() {
+            for (int i = 0; i < 200; i++)
+            {
+                Logger::Debug("THREAD", "{} {}", t, i);
+            }
+        });
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+    Logger::Flush();
+
+    cr_assert_eq(ReadLines(path).size(), 800u);
+    unlink(path.c_str());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+Test(Logger, arguments_fill_placeholders_in_order)
+{
+    std::string path = "/tmp/plazza_logger_test_format_" +
+        std::to_string(getpid()) + ".log";
+    std::string name = "kitchen";
+
+    unlink(path.c_str());
+    Logger::SetConsoleOutput(false);
+    Logger::SetLogFile(path);
+
+    Logger::Warning("TEST", "{} {} has {} cooks, {}", name, 3, 2.5, true);
+    Logger::Error("TEST", "{} missing", "x", "unused");
+    Logger::Flush();
+
+    std::vector<std::string> lines = ReadLines(path);
+    cr_assert_eq(lines.size(), 2u);
+    cr_assert(lines[0].ends_with("[TEST] kitchen 3 has 2.5 cooks, true"));
+    cr_assert(lines[1].ends_with("[ERROR] [TEST] x missing"));
+    unlink(path.c_str());
+}
@@ -0,0 +1,60 @@
+///////////////////////////////////////////////////////////////////////////////
+// Dependencies
+///////////////////////////////////////////////////////////////////////////////
+#include "Reception/OrderReader.hpp"
+#include "Errors/InvalidArgument.hpp"
+#include <criterion/criterion.h>
+#include <fstream>
+#include <string>
+#include <unistd.h>
+
+///////////////////////////////////////////////////////////////////////////////
+using namespace Plazza;
+
+///////////////////////////////////////////////////////////////////////////////
+// Test Suite for OrderReader
+///////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////////
+Test(OrderReader, chunks_hold_whole_lines)
+{
+    std::string path = "/tmp/plazza_orders_test_" +
+        std::to_string(getpid()) + ".txt";
+    std::string content;
+
+    for (size_t i = 0; content.size() < 5 * OrderReader::CHUNK_SIZE; i++)
+    {
+        content += "regina S x" + std::to_string(i + 1) + "\n";
+    }
+    content += "margarita XXL x2";
+    std::ofstream(path) << content;
+
+    std::string read;
+    {
+        OrderReader reader(path);
+
+        while (auto chunk = reader.NextChunk())
+        {
+            cr_assert(!chunk->empty(), "Chunks should never be empty");
+            if (read.size() + chunk->size() < content.size())
+            {
+                cr_assert_eq(chunk->back(), '\n', "Should cut after a line");
+            }
+            read += chunk.value();
+        }
+        cr_assert_eq(reader.GetBytesRead(), content.size());
+    }
+    unlink(path.c_str());
+
+    cr_assert(read == content, "Should read the file back unchanged");
+}
+
+///////////////////////////////////////////////////////////////////////////////
+Test(OrderReader, missing_file_throws)
+{
+    cr_assert_throw(
+        OrderReader("/tmp/plazza_no_such_orders_file"),
+        InvalidArgument,
+        "Should throw InvalidArgument for a missing file"
+    );
+}
@@ -0,0 +1,150 @@
+///////////////////////////////////////////////////////////////////////////////
+// Dependencies
+///////////////////////////////////////////////////////////////////////////////
+#include "Reception/ParallelParser.hpp"
+#include "Errors/ParsingException.hpp"
+#include <criterion/criterion.h>
+#include <string>
+
+///////////////////////////////////////////////////////////////////////////////
+using namespace Plazza;
+
+///////////////////////////////////////////////////////////////////////////////
+// Test Suite for ParallelParser
+///////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////////
+static std::string RepeatSegments(size_t count)
+{
+    static const char* SEGMENTS[] = {"regina S x1", " margarita XL x2 "};
+    std::string line;
+
+    for (size_t i = 0; i < count; i++)
+    {
+        line += (i ? ";" : "");
+        line += SEGMENTS[i % 2];
+    }
+    return (line);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+Test(ParallelParser, parse_line_matches_sequential)
+{
+    ParallelParser parser(3);
+    std::string line = RepeatSegments(
+        ParallelParser::SEGMENTS_PER_CHUNK * 5 + 7) + " ;  ";
+    Parser::Orders expected = Parser::ParseOrders(line);
+    Parser::Orders found;
+    size_t parts = 0;
+
+    parser.ParseLine(line, [&](const Parser::Orders& orders) {
+        found.insert(found.end(), orders.begin(), orders.end());
+        parts++;
+    });
+
+    cr_assert_eq(parts, 6, "Should hand over one part per chunk");
+    cr_assert_eq(found.size(), expected.size(), "Should keep every segment");
+    for (size_t i = 0; i < found.size(); i++)
+    {
+        cr_assert(found[i].type == expected[i].type &&
+            found[i].size == expected[i].size &&
+            found[i].count == expected[i].count,
+            "Segment %zu out of order", i);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+Test(ParallelParser, parse_line_error_column)
+{
+    ParallelParser parser(2);
+    std::string line = RepeatSegments(ParallelParser::SEGMENTS_PER_CHUNK * 3);
+    size_t column = line.size() + 3;
+    size_t found = 0;
+
+    line += "; pasta S x1";
+    try
+    {
+        parser.ParseLine(line, [](const Parser::Orders&) {});
+    }
+    catch (const ParsingException& e)
+    {
+        found = e.GetColumn();
+    }
+
+    cr_assert_eq(found, column, "Column should count from the line start");
+}
+
+///////////////////////////////////////////////////////////////////////////////
+Test(ParallelParser, parse_line_bad_tail_after_chunks)
+{
+    ParallelParser parser(4);
+    std::string line = RepeatSegments(
+        ParallelParser::SEGMENTS_PER_CHUNK * 4 - 1);
+    uint64_t total = Parser::CountPizzas(Parser::ParseOrders(line));
+    uint64_t consumed = 0;
+    bool thrown = false;
+
+    line += "; regina S x0";
+    cr_assert_geq(line.size(), ParallelParser::MIN_PARALLEL_SIZE,
+        "Line should be long enough for the parallel path");
+    try
+    {
+        parser.ParseLine(line, [&](const Parser::Orders& orders) {
+            consumed += Parser::CountPizzas(orders);
+        });
+    }
+    catch (const ParsingException&)
+    {
+        thrown = true;
+    }
+
+    cr_assert(thrown, "A bad final segment should reject the line");
+    cr_assert(consumed > 0 && consumed < total,
+        "Only the chunks before the bad one should be handed over");
+}
+
+///////////////////////////////////////////////////////////////////////////////
+Test(ParallelParser, parse_line_total_overflow)
+{
+    ParallelParser parser(2);
+    std::string line = RepeatSegments(ParallelParser::SEGMENTS_PER_CHUNK);
+
+    line += "; regina S x2000000000";
+    line += ";" + RepeatSegments(ParallelParser::SEGMENTS_PER_CHUNK);
+    line += "; regina S x2000000000";
+
+    cr_assert_throw(
+        parser.ParseLine(line, [](const Parser::Orders&) {}),
+        ParsingException,
+        "Should count the limit across chunks"
+    );
+}
+
+///////////////////////////////////////////////////////////////////////////////
+Test(ParallelParser, parse_lines_in_order)
+{
+    ParallelParser parser(2);
+    std::string text;
+    size_t lines = ParallelParser::LINES_PER_CHUNK * 3 + 1;
+    size_t index = 0;
+    size_t errors = 0;
+
+    for (size_t i = 0; i < lines; i++)
+    {
+        text += i % 100 == 1 ? "# comment\n" : i % 100 == 2 ? "pasta\n" :
+            "regina S x" + std::to_string(i + 1) + "\n";
+    }
+
+    parser.ParseLines(text, [&](const ParallelParser::ParsedLine& line) {
+        if (!line.skipped && line.error.empty())
+        {
+            cr_assert_eq(line.orders.front().count, index + 1,
+                "Line %zu out of order", index);
+        }
+        errors += !line.error.empty();
+        index++;
+    });
+
+    cr_assert_eq(index, lines, "Should hand over every line");
+    cr_assert_eq(errors, 8, "Should report the invalid lines");
+}
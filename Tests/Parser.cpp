@@ -5,6 +5,7 @@
 #include "Errors/ParsingException.hpp"
 #include "Errors/InvalidArgument.hpp"
 #include <criterion/criterion.h>
+#include <utility>
 
 ///////////////////////////////////////////////////////////////////////////////
 using namespace Plazza;
@@ -24,9 +25,10 @@ Test(Parser, parse_single_valid_order)
 {
     auto orders = Parser::ParseOrders("regina S x1");
 
-    cr_assert_eq(orders.size(), 1, "Should parse one pizza");
-    cr_assert_not_null(orders[0].get(), "Pizza should be created");
-    cr_assert_eq(orders[0]->GetSize(), IPizza::Size::S, "Pizza should have size S");
+    cr_assert_eq(orders.size(), 1, "Should parse one line");
+    cr_assert_eq(orders[0].count, 1, "Should order one pizza");
+    cr_assert_eq(orders[0].type, IPizza::Type::Regina, "Pizza should be a regina");
+    cr_assert_eq(orders[0].size, IPizza::Size::S, "Pizza should have size S");
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -34,11 +36,9 @@ Test(Parser, parse_multiple_quantities)
 {
     auto orders = Parser::ParseOrders("margarita M x3");
 
-    cr_assert_eq(orders.size(), 3, "Should parse three pizzas");
-    for (const auto& pizza : orders) {
-        cr_assert_not_null(pizza.get(), "All pizzas should be created");
-        cr_assert_eq(pizza->GetSize(), IPizza::Size::M, "All pizzas should have size M");
-    }
+    cr_assert_eq(orders.size(), 1, "Should keep the quantity run-length");
+    cr_assert_eq(orders[0].count, 3, "Should parse three pizzas");
+    cr_assert_eq(orders[0].size, IPizza::Size::M, "All pizzas should have size M");
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -46,11 +46,12 @@ Test(Parser, parse_multiple_orders_semicolon_separated)
 {
     auto orders = Parser::ParseOrders("regina S x1; fantasia L x2; americana XL x1");
 
-    cr_assert_eq(orders.size(), 4, "Should parse four pizzas total");
-    cr_assert_eq(orders[0]->GetSize(), IPizza::Size::S, "First pizza should be size S");
-    cr_assert_eq(orders[1]->GetSize(), IPizza::Size::L, "Second pizza should be size L");
-    cr_assert_eq(orders[2]->GetSize(), IPizza::Size::L, "Third pizza should be size L");
-    cr_assert_eq(orders[3]->GetSize(), IPizza::Size::XL, "Fourth pizza should be size XL");
+    cr_assert_eq(orders.size(), 3, "Should parse three lines");
+    cr_assert_eq(Parser::CountPizzas(orders), 4, "Should parse four pizzas total");
+    cr_assert_eq(orders[0].size, IPizza::Size::S, "First line should be size S");
+    cr_assert_eq(orders[1].size, IPizza::Size::L, "Second line should be size L");
+    cr_assert_eq(orders[1].type, IPizza::Type::Fantasia, "Second line should be fantasia");
+    cr_assert_eq(orders[2].size, IPizza::Size::XL, "Third line should be size XL");
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -59,11 +60,11 @@ Test(Parser, parse_all_pizza_sizes)
     auto orders = Parser::ParseOrders("regina S x1; fantasia M x1; americana L x1; margarita XL x1; regina XXL x1");
 
     cr_assert_eq(orders.size(), 5, "Should parse five pizzas");
-    cr_assert_eq(orders[0]->GetSize(), IPizza::Size::S, "First pizza should be size S");
-    cr_assert_eq(orders[1]->GetSize(), IPizza::Size::M, "Second pizza should be size M");
-    cr_assert_eq(orders[2]->GetSize(), IPizza::Size::L, "Third pizza should be size L");
-    cr_assert_eq(orders[3]->GetSize(), IPizza::Size::XL, "Fourth pizza should be size XL");
-    cr_assert_eq(orders[4]->GetSize(), IPizza::Size::XXL, "Fifth pizza should be size XXL");
+    cr_assert_eq(orders[0].size, IPizza::Size::S, "First pizza should be size S");
+    cr_assert_eq(orders[1].size, IPizza::Size::M, "Second pizza should be size M");
+    cr_assert_eq(orders[2].size, IPizza::Size::L, "Third pizza should be size L");
+    cr_assert_eq(orders[3].size, IPizza::Size::XL, "Fourth pizza should be size XL");
+    cr_assert_eq(orders[4].size, IPizza::Size::XXL, "Fifth pizza should be size XXL");
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -71,10 +72,10 @@ Test(Parser, parse_with_extra_whitespace)
 {
     auto orders = Parser::ParseOrders("  regina   S   x1  ;  fantasia   M   x2  ");
 
-    cr_assert_eq(orders.size(), 3, "Should parse three pizzas despite extra whitespace");
-    cr_assert_eq(orders[0]->GetSize(), IPizza::Size::S, "First pizza should be size S");
-    cr_assert_eq(orders[1]->GetSize(), IPizza::Size::M, "Second pizza should be size M");
-    cr_assert_eq(orders[2]->GetSize(), IPizza::Size::M, "Third pizza should be size M");
+    cr_assert_eq(Parser::CountPizzas(orders), 3, "Should parse three pizzas despite extra whitespace");
+    cr_assert_eq(orders[0].size, IPizza::Size::S, "First pizza should be size S");
+    cr_assert_eq(orders[1].size, IPizza::Size::M, "Second line should be size M");
+    cr_assert_eq(orders[1].count, 2, "Second line should order two pizzas");
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -188,11 +189,9 @@ Test(Parser, parse_large_quantity)
 {
     auto orders = Parser::ParseOrders("regina S x100");
 
-    cr_assert_eq(orders.size(), 100, "Should handle large quantities");
-    for (const auto& pizza : orders) {
-        cr_assert_not_null(pizza.get(), "All pizzas should be created");
-        cr_assert_eq(pizza->GetSize(), IPizza::Size::S, "All pizzas should have correct size");
-    }
+    cr_assert_eq(orders.size(), 1, "Should not expand large quantities");
+    cr_assert_eq(orders[0].count, 100, "Should handle large quantities");
+    cr_assert_eq(orders[0].size, IPizza::Size::S, "All pizzas should have correct size");
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -240,3 +239,49 @@ Test(Parser, parse_case_sensitive_sizes)
         "Should throw ParsingException for lowercase size"
     );
 }
+
+///////////////////////////////////////////////////////////////////////////////
+Test(Parser, parse_trailing_semicolon)
+{
+    auto orders = Parser::ParseOrders("regina S x1; fantasia M x2 ;  ");
+
+    cr_assert_eq(Parser::CountPizzas(orders), 3, "Should ignore a trailing semicolon");
+}
+
+///////////////////////////////////////////////////////////////////////////////
+Test(Parser, parse_error_columns)
+{
+    const std::pair<const char*, size_t> cases[] = {
+        {"regina Z x1", 8},
+        {"regina S x0", 11},
+        {"  pasta S x1", 3},
+        {"regina S x1 ; regina M 2", 24},
+        {"regina S x1 fantasia", 13},
+        {"regina S x1;;", 13}
+    };
+
+    for (const auto& [line, column] : cases)
+    {
+        size_t found = 0;
+
+        try
+        {
+            Parser::ParseOrders(line);
+        }
+        catch (const ParsingException& e)
+        {
+            found = e.GetColumn();
+        }
+        cr_assert_eq(found, column, "Wrong column for '%s'", line);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+Test(Parser, parse_order_total_overflow)
+{
+    cr_assert_throw(
+        Parser::ParseOrders("regina S x2000000000; fantasia M x2000000000"),
+        ParsingException,
+        "Should throw when an order adds up past the quantity limit"
+    );
+}
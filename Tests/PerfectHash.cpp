@@ -0,0 +1,39 @@
+///////////////////////////////////////////////////////////////////////////////
+// Dependencies
+///////////////////////////////////////////////////////////////////////////////
+#include "Utils/PerfectHash.hpp"
+#include "Errors/InvalidArgument.hpp"
+#include <criterion/criterion.h>
+
+///////////////////////////////////////////////////////////////////////////////
+using namespace Plazza;
+
+///////////////////////////////////////////////////////////////////////////////
+// Test Suite for PerfectHash
+///////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////////
+Test(PerfectHash, finds_every_key_and_nothing_else)
+{
+    std::vector<std::string> keys;
+
+    for (int i = 0; i < 1000; i++)
+    {
+        keys.push_back("key" + std::to_string(i));
+    }
+    PerfectHash hash(keys);
+
+    for (uint32_t i = 0; i < keys.size(); i++)
+    {
+        cr_assert_eq(hash.Find(keys[i]), i, "Key %u not found", i);
+    }
+    cr_assert_eq(hash.Find("key1000"), PerfectHash::NOT_FOUND, "Not a key");
+    cr_assert_eq(hash.Find(""), PerfectHash::NOT_FOUND, "Empty key");
+    cr_assert_eq(PerfectHash().Find("key0"), PerfectHash::NOT_FOUND, "Empty");
+}
+
+///////////////////////////////////////////////////////////////////////////////
+Test(PerfectHash, rejects_duplicates)
+{
+    cr_assert_throw(PerfectHash({"a", "b", "a"}), InvalidArgument, "Twice");
+}
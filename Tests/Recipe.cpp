@@ -0,0 +1,113 @@
+///////////////////////////////////////////////////////////////////////////////
+// Dependencies
+///////////////////////////////////////////////////////////////////////////////
+#include "Pizza/Recipe.hpp"
+#include "Pizza/PizzaFactory.hpp"
+#include "Errors/InvalidArgument.hpp"
+#include "Errors/ParsingException.hpp"
+#include <criterion/criterion.h>
+
+///////////////////////////////////////////////////////////////////////////////
+using namespace Plazza;
+
+///////////////////////////////////////////////////////////////////////////////
+// Test Suite for RecipeBook
+///////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////////
+Test(RecipeBook, facades_share_the_table)
+{
+    auto regina = PizzaFactory::GetInstance().CreatePizza(
+        "regina", IPizza::Size::XL);
+    const Recipe* recipe = RecipeBook::Unpack(regina->Pack());
+
+    cr_assert_eq(&regina->GetRecipe(), recipe, "Should share one entry");
+    cr_assert_eq(recipe->ingredients, 0x1F, "Regina needs the first five");
+    cr_assert_eq(regina->GetIngredients().size(), 5, "Regina has 5");
+    cr_assert_eq(regina->ToString(), "Extra Large Regina", "Wrong label");
+}
+
+///////////////////////////////////////////////////////////////////////////////
+Test(RecipeBook, unpack_rejects_unknown_pizzas)
+{
+    auto word = [](uint64_t type, uint64_t size) {
+        return (PackedPizza::FromWord(type << 32 | size << 48));
+    };
+
+    cr_assert_not_null(RecipeBook::Unpack(word(0, 0)), "Regina S");
+    cr_assert_null(RecipeBook::Unpack(word(4, 0)), "No fifth type");
+    cr_assert_null(RecipeBook::Unpack(word(0, 5)), "No sixth size");
+    cr_assert_not_null(RecipeBook::Unpack(word(3, 4)), "Fantasia XXL");
+}
+
+///////////////////////////////////////////////////////////////////////////////
+Test(PackedPizza, round_trips_every_field)
+{
+    constexpr PackedPizza packed = PackedPizza::Encode(
+        static_cast<IPizza::Type>(300), IPizza::Size::XL, 0xDEADBEEF
+    );
+    static_assert(packed.GetType() == static_cast<IPizza::Type>(300));
+    static_assert(packed.GetSize() == IPizza::Size::XL);
+    static_assert(packed.GetOrder() == 0xDEADBEEF);
+    static_assert(PackedPizza().GetWord() == 0);
+
+    PackedPizza moved = packed.WithOrder(7);
+
+    cr_assert_eq(moved.GetOrder(), 7, "Order replaced");
+    cr_assert_eq(moved.WithOrder(0xDEADBEEF), packed, "Nothing else changed");
+    cr_assert_eq(PackedPizza::FromWord(packed.GetWord()), packed, "Word");
+}
+
+///////////////////////////////////////////////////////////////////////////////
+Test(IngredientCounts, compares_every_lane)
+{
+    IngredientCounts stock = IngredientCounts::FromMask(0x1FF, 2);
+    IngredientCounts need = RecipeBook::Find(
+        IPizza::Type::Fantasia, IPizza::Size::S)->needs;
+
+    cr_assert(stock.Covers(need), "Two of everything covers a fantasia");
+    stock -= need;
+    stock -= need;
+    cr_assert_eq(stock[2], 2, "Gruyere is not in a fantasia");
+    cr_assert_not(stock.Covers(need), "Nothing left for a third");
+    cr_assert_eq(stock.GetShortfall(need), 1, "One unit short per lane");
+    stock += need;
+    cr_assert(stock.Covers(need), "Given back");
+}
+
+///////////////////////////////////////////////////////////////////////////////
+Test(RecipeBook, parses_a_menu_file)
+{
+    std::string text = "# forty pizzas\nsizes 1 1 1 2 2.5\n";
+
+    for (int i = 0; i < 40; i++)
+    {
+        text += "pizza_" + std::to_string(i) + " 1.5 dough ham\n";
+    }
+    RecipeBook::Menu menu = RecipeBook::Parse(text);
+    const Recipe& recipe = menu.table[39 * RecipeBook::SIZE_COUNT + 4];
+
+    cr_assert_eq(menu.types.Find("pizza_39"), 39, "Types follow the file");
+    cr_assert_eq(recipe.baseCookingTime.count(), 3750, "1.5s scaled by 2.5");
+    cr_assert_eq(recipe.ToString(), "Extra Extra Large Pizza 39", "Label");
+    cr_assert_eq(recipe.ingredients, 0x9, "Dough and ham");
+
+    cr_assert_throw(RecipeBook::Parse("regina 2 dough pineapple"),
+        ParsingException, "Unknown ingredient");
+    cr_assert_throw(RecipeBook::Parse("a 1 dough\na 2 ham"),
+        ParsingException, "Listed twice");
+    cr_assert_throw(RecipeBook::Parse("# empty\n"),
+        ParsingException, "No pizza");
+}
+
+///////////////////////////////////////////////////////////////////////////////
+Test(RecipeBook, keeps_the_menu_in_use)
+{
+    const Recipe* recipe = RecipeBook::Find(
+        IPizza::Type::Regina, IPizza::Size::S);
+
+    cr_assert_throw(RecipeBook::Load("pizza_0 1 dough\n"),
+        InvalidArgument, "Pizzas may refer to the menu in use");
+    cr_assert(PizzaFactory::HasFactory("regina"), "Menu was kept");
+    cr_assert_eq(recipe->name, "Regina", "Recipe still valid");
+}
@@ -0,0 +1,347 @@
+///////////////////////////////////////////////////////////////////////////////
+// Dependencies
+///////////////////////////////////////////////////////////////////////////////
+#include "Utils/Logger.hpp"
+#include <algorithm>
+#include <cstring>
+#include <ctime>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <map>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+using Plazza::Logger;
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief One binary segment, read whole
+///
+///////////////////////////////////////////////////////////////////////////////
+struct Segment
+{
+    Logger::SegmentHeader header;   //<!
+    std::vector<char> data;         //<!
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief A decoded log line
+///
+///////////////////////////////////////////////////////////////////////////////
+struct Line
+{
+    int64_t time;           //<!
+    uint8_t level;          //<!
+    std::string sender;     //<!
+    std::string message;    //<!
+};
+
+///////////////////////////////////////////////////////////////////////////////
+using Strings = std::map<uint32_t, std::map<uint16_t, std::string>>;
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Read every .plog file of a directory
+///
+/// \param directory
+///
+/// \return The valid segments, by process then index
+///
+///////////////////////////////////////////////////////////////////////////////
+static std::vector<Segment> ReadSegments(const std::string& directory)
+{
+    std::vector<Segment> segments;
+
+    for (const auto& entry : std::filesystem::directory_iterator(directory))
+    {
+        if (entry.path().extension() != ".plog")
+        {
+            continue;
+        }
+
+        std::ifstream file(entry.path(), std::ios::binary);
+        Segment segment;
+
+        segment.data.assign(
+            std::istreambuf_iterator<char>(file),
+            std::istreambuf_iterator<char>()
+        );
+        if (segment.data.size() < sizeof(Logger::SegmentHeader))
+        {
+            continue;
+        }
+        std::memcpy(
+            &segment.header, segment.data.data(), sizeof(segment.header)
+        );
+        if (std::memcmp(segment.header.magic, Logger::SEGMENT_MAGIC,
+            sizeof(Logger::SEGMENT_MAGIC)) != 0)
+        {
+            continue;
+        }
+        segments.push_back(std::move(segment));
+    }
+
+    std::sort(segments.begin(), segments.end(),
+        [](const Segment& a, const Segment& b) {
+            return (a.header.pid != b.header.pid ?
+                a.header.pid < b.header.pid : a.header.index < b.header.index);
+        });
+    return (segments);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Decode the arguments of a record as text
+///
+/// \param data
+/// \param end
+/// \param count
+///
+/// \return As Logger would have formatted them, until the first bad one
+///
+///////////////////////////////////////////////////////////////////////////////
+static std::vector<std::string> DecodeArgs(
+    const char* data,
+    const char* end,
+    size_t count
+)
+{
+    std::vector<std::string> args;
+
+    while (args.size() < count && data < end)
+    {
+        auto type = static_cast<Logger::ArgType>(*data++);
+        char buffer[32];
+
+        if (type == Logger::ArgType::BOOL && data + 1 <= end)
+        {
+            args.push_back(*data ? "true" : "false");
+            data += 1;
+        }
+        else if (type == Logger::ArgType::CHAR && data + 1 <= end)
+        {
+            args.push_back(std::string(1, *data));
+            data += 1;
+        }
+        else if (type == Logger::ArgType::INT && data + 8 <= end)
+        {
+            int64_t value;
+            std::memcpy(&value, data, sizeof(value));
+            args.push_back(std::to_string(value));
+            data += sizeof(value);
+        }
+        else if (type == Logger::ArgType::UINT && data + 8 <= end)
+        {
+            uint64_t value;
+            std::memcpy(&value, data, sizeof(value));
+            args.push_back(std::to_string(value));
+            data += sizeof(value);
+        }
+        else if (type == Logger::ArgType::DOUBLE && data + 8 <= end)
+        {
+            double value;
+            std::memcpy(&value, data, sizeof(value));
+            std::snprintf(buffer, sizeof(buffer), "%g", value);
+            args.push_back(buffer);
+            data += sizeof(value);
+        }
+        else if (type == Logger::ArgType::STRING && data + 2 <= end)
+        {
+            uint16_t length;
+            std::memcpy(&length, data, sizeof(length));
+            data += sizeof(length);
+            if (data + length > end)
+            {
+                break;
+            }
+            args.emplace_back(data, length);
+            data += length;
+        }
+        else
+        {
+            break;
+        }
+    }
+    return (args);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Call a function on each complete record of a segment
+///
+/// \param segment
+/// \param visit Takes the header and the bounds of the arguments
+///
+///////////////////////////////////////////////////////////////////////////////
+template <typename Visitor>
+static void ForEachRecord(const Segment& segment, Visitor visit)
+{
+    size_t end = std::min<size_t>({
+        segment.header.cursor, segment.header.capacity, segment.data.size()
+    });
+    size_t offset = sizeof(Logger::SegmentHeader);
+
+    while (offset + sizeof(Logger::RecordHeader) <= end)
+    {
+        Logger::RecordHeader record;
+
+        std::memcpy(&record, segment.data.data() + offset, sizeof(record));
+        if (record.size < sizeof(record) || offset + record.size > end)
+        {
+            break;
+        }
+        visit(
+            record,
+            segment.data.data() + offset + sizeof(record),
+            segment.data.data() + offset + record.size
+        );
+        offset += record.size;
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief
+///
+/// \param format
+/// \param args
+///
+/// \return The format with each `{}` replaced by the next argument
+///
+///////////////////////////////////////////////////////////////////////////////
+static std::string Format(
+    const std::string& format,
+    const std::vector<std::string>& args
+)
+{
+    std::string out;
+    size_t position = 0;
+
+    for (const auto& arg : args)
+    {
+        size_t placeholder = format.find("{}", position);
+        if (placeholder == std::string::npos)
+        {
+            break;
+        }
+        out.append(format, position, placeholder - position);
+        out += arg;
+        position = placeholder + 2;
+    }
+    out.append(format, position);
+    return (out);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Decode every line of every segment
+///
+/// \param segments
+///
+/// \return The lines, oldest first
+///
+///////////////////////////////////////////////////////////////////////////////
+static std::vector<Line> DecodeLines(const std::vector<Segment>& segments)
+{
+    Strings strings;
+    std::vector<Line> lines;
+
+    // Strings are defined once per process, in any of its segments.
+    for (const auto& segment : segments)
+    {
+        auto& table = strings[segment.header.pid];
+
+        ForEachRecord(segment, [&table](const Logger::RecordHeader& record,
+            const char* data, const char* end) {
+            auto kind = static_cast<Logger::RecordKind>(record.kind);
+            if (kind == Logger::RecordKind::STRING)
+            {
+                auto args = DecodeArgs(data, end, 1);
+                table[record.format] = args.empty() ? "" : args.front();
+            }
+        });
+    }
+
+    for (const auto& segment : segments)
+    {
+        auto& table = strings[segment.header.pid];
+        auto lookup = [&table](uint16_t id) {
+            auto it = table.find(id);
+            return (it != table.end() ? it->second : "?");
+        };
+
+        ForEachRecord(segment, [&](const Logger::RecordHeader& record,
+            const char* data, const char* end) {
+            auto kind = static_cast<Logger::RecordKind>(record.kind);
+            if (kind == Logger::RecordKind::LINE)
+            {
+                lines.push_back({
+                    record.time, record.level, lookup(record.sender),
+                    Format(lookup(record.format),
+                        DecodeArgs(data, end, record.argCount))
+                });
+            }
+        });
+    }
+
+    std::stable_sort(lines.begin(), lines.end(),
+        [](const Line& a, const Line& b) {
+            return (a.time < b.time);
+        });
+    return (lines);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Write lines as the text logger would have
+///
+/// \param lines
+/// \param out
+///
+///////////////////////////////////////////////////////////////////////////////
+static void WriteLines(const std::vector<Line>& lines, std::ostream& out)
+{
+    for (const auto& line : lines)
+    {
+        std::time_t seconds = static_cast<std::time_t>(line.time / 1000000000);
+        std::tm localTime;
+        char timestamp[32];
+
+        localtime_r(&seconds, &localTime);
+        std::strftime(
+            timestamp, sizeof(timestamp), "%Y-%m-%d %H:%M:%S", &localTime
+        );
+        out << "[" << timestamp << "] ["
+            << Logger::LogLevelToString(static_cast<Logger::Level>(line.level))
+            << "] [" << line.sender << "] " << line.message << "\n";
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main(int argc, char* argv[])
+{
+    if (argc < 2 || argc > 3)
+    {
+        std::cerr << "Usage: " << argv[0] << " <log_dir> [output.log]"
+                  << std::endl;
+        return (84);
+    }
+
+    try
+    {
+        std::vector<Line> lines = DecodeLines(ReadSegments(argv[1]));
+
+        if (argc == 3)
+        {
+            std::ofstream out(argv[2]);
+            WriteLines(lines, out);
+        }
+        else
+        {
+            WriteLines(lines, std::cout);
+        }
+        std::cerr << lines.size() << " line(s) decoded" << std::endl;
+    }
+    catch (const std::exception& e)
+    {
+        std::cerr << e.what() << std::endl;
+        return (84);
+    }
+
+    return (0);
+}
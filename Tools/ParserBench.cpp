@@ -0,0 +1,187 @@
+///////////////////////////////////////////////////////////////////////////////
+// Dependencies
+///////////////////////////////////////////////////////////////////////////////
+#include "Reception/Parser.hpp"
+#include "Pizza/PizzaFactory.hpp"
+#include "Errors/ParsingException.hpp"
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <iterator>
+#include <new>
+#include <regex>
+#include <sstream>
+
+///////////////////////////////////////////////////////////////////////////////
+using Plazza::Parser;
+using Plazza::PizzaFactory;
+using Plazza::ParsingException;
+
+///////////////////////////////////////////////////////////////////////////////
+// Allocation counter, to check that scanning allocates nothing
+///////////////////////////////////////////////////////////////////////////////
+static size_t s_allocations = 0;
+
+// Kept out of line, or GCC pairs the inlined free with new and warns
+__attribute__((noinline)) void* operator new(size_t size)
+{
+    s_allocations++;
+    if (void* ptr = std::malloc(size ? size : 1))
+    {
+        return (ptr);
+    }
+    throw std::bad_alloc();
+}
+
+__attribute__((noinline)) void operator delete(void* ptr) noexcept
+{
+    std::free(ptr);
+}
+
+__attribute__((noinline)) void operator delete(
+    void* ptr,
+    size_t
+) noexcept
+{
+    std::free(ptr);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief The regex scanner the Parser used before, without pizza creation
+///
+/// \param line
+///
+/// \return Total quantity ordered
+///
+///////////////////////////////////////////////////////////////////////////////
+static uint64_t ScanWithRegex(const std::string& line)
+{
+    static const std::regex ORDER_EXP{
+        R"(^\s*([a-zA-Z]+)\s+(S|M|L|XL|XXL)\s+(x[1-9][0-9]*)\s*$)"
+    };
+    std::stringstream ss(Parser::Trim(line));
+    std::string segment;
+    uint64_t total = 0;
+
+    while (std::getline(ss, segment, ';'))
+    {
+        std::string trimmed = Parser::Trim(segment);
+        std::smatch match;
+
+        if (trimmed.empty() || !std::regex_match(trimmed, match, ORDER_EXP))
+        {
+            throw ParsingException("Invalid order format");
+        }
+        if (!PizzaFactory::GetInstance().HasFactory(match[1].str()))
+        {
+            throw ParsingException("Invalid pizza type");
+        }
+        total += static_cast<uint64_t>(std::stoi(match[3].str().substr(1)));
+    }
+    return (total);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief
+///
+/// \param line
+///
+/// \return Total quantity ordered
+///
+///////////////////////////////////////////////////////////////////////////////
+static uint64_t ScanWithScanner(std::string_view line)
+{
+    Parser::OrderLine order;
+    size_t offset = 0;
+    uint64_t total = 0;
+
+    while (offset != std::string_view::npos)
+    {
+        offset = Parser::ScanSegment(line, offset, order);
+        total += order.count;
+    }
+    return (total);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Time a scanner over the line, and count what it allocated
+///
+/// \param name
+/// \param line
+/// \param segments
+/// \param rounds
+/// \param scan
+///
+/// \return Nanoseconds per segment
+///
+///////////////////////////////////////////////////////////////////////////////
+template <typename Scan>
+static double Measure(
+    const char* name,
+    const std::string& line,
+    size_t segments,
+    size_t rounds,
+    Scan scan
+)
+{
+    uint64_t total = scan(line);
+    size_t allocations = s_allocations;
+    auto begin = std::chrono::steady_clock::now();
+
+    for (size_t i = 0; i < rounds; i++)
+    {
+        total += scan(line);
+    }
+
+    auto end = std::chrono::steady_clock::now();
+    double ns = std::chrono::duration<double, std::nano>(end - begin).count()
+        / static_cast<double>(segments * rounds);
+
+    std::printf("%-8s %10.1f ns/segment  %8.2f alloc/segment  (%lu)\n",
+        name, ns, static_cast<double>(s_allocations - allocations)
+        / static_cast<double>(segments * rounds),
+        static_cast<unsigned long>(total));
+    return (ns);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main(int argc, char* argv[])
+{
+    static const char* SEGMENTS[] = {
+        "regina S x1", "margarita XXL x12", "  americana   L   x3 ",
+        "fantasia XL x250"
+    };
+    size_t segments = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 10000;
+    size_t rounds = argc > 2 ? std::strtoul(argv[2], nullptr, 10) : 20;
+    std::string line;
+
+    if (segments == 0 || rounds == 0)
+    {
+        std::cerr << "Usage: " << argv[0] << " [segments] [rounds]"
+                  << std::endl;
+        return (84);
+    }
+
+    for (size_t i = 0; i < segments; i++)
+    {
+        line += (i ? ";" : "");
+        line += SEGMENTS[i % std::size(SEGMENTS)];
+    }
+
+    try
+    {
+        double regex = Measure("regex", line, segments, rounds, ScanWithRegex);
+        double scanner = Measure("scanner", line, segments, rounds,
+            [](const std::string& l) { return (ScanWithScanner(l)); });
+
+        std::printf("speedup  %10.1fx\n", regex / scanner);
+    }
+    catch (const std::exception& e)
+    {
+        std::cerr << e.what() << std::endl;
+        return (84);
+    }
+
+    return (0);
+}
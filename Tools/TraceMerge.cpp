@@ -0,0 +1,197 @@
+///////////////////////////////////////////////////////////////////////////////
+// Dependencies
+///////////////////////////////////////////////////////////////////////////////
+#include "Utils/Tracer.hpp"
+#include <algorithm>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <set>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+using Plazza::Tracer;
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Read every record of every .trace file in a directory
+///
+/// \param directory
+///
+/// \return The records, oldest first
+///
+///////////////////////////////////////////////////////////////////////////////
+static std::vector<Tracer::Record> ReadRecords(const std::string& directory)
+{
+    std::vector<Tracer::Record> records;
+
+    for (const auto& entry : std::filesystem::directory_iterator(directory))
+    {
+        if (entry.path().extension() != ".trace")
+        {
+            continue;
+        }
+
+        std::ifstream file(entry.path(), std::ios::binary);
+        Tracer::Record record;
+
+        while (file.read(reinterpret_cast<char*>(&record), sizeof(record)))
+        {
+            records.push_back(record);
+        }
+    }
+
+    std::sort(records.begin(), records.end(),
+        [](const Tracer::Record& a, const Tracer::Record& b) {
+            return (a.begin < b.begin);
+        });
+    return (records);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief
+///
+/// \param record
+///
+/// \return The args object of a record, as JSON
+///
+///////////////////////////////////////////////////////////////////////////////
+static std::string FormatArgs(const Tracer::Record& record)
+{
+    auto event = static_cast<Tracer::Event>(record.event);
+    std::string a0 = std::to_string(record.arg0);
+    std::string a1 = std::to_string(record.arg1);
+
+    switch (event)
+    {
+        case Tracer::Event::ORDER_PARSE:
+            return ("{\"pizzas\":" + a0 + "}");
+        case Tracer::Event::DISPATCH:
+            return ("{\"order\":" + a0 +
+                ",\"sequence\":" + std::to_string(record.arg1 >> 32) +
+                ",\"kitchen\":" + std::to_string(record.arg1 & 0xFFFFFFFF) +
+                "}");
+        case Tracer::Event::IPC_SEND:
+        case Tracer::Event::IPC_RECEIVE:
+            return ("{\"type\":" + a0 + ",\"bytes\":" + a1 + "}");
+        case Tracer::Event::STATUS_SEND:
+            return ("{\"queued\":" + a0 + "}");
+        default:
+            return ("{\"order\":" + a0 + ",\"sequence\":" + a1 + "}");
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief
+///
+/// \param record
+///
+/// \return The name shown for the record's process
+///
+///////////////////////////////////////////////////////////////////////////////
+static std::string GetProcessName(const Tracer::Record& record)
+{
+    switch (static_cast<Tracer::Role>(record.role))
+    {
+        case Tracer::Role::ZYGOTE:
+            return ("Zygote");
+        case Tracer::Role::KITCHEN:
+            return ("Kitchen " + std::to_string(record.kitchen));
+        default:
+            return ("Reception");
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief
+///
+/// \param ns
+///
+/// \return Microseconds with three decimals, as Chrome expects
+///
+///////////////////////////////////////////////////////////////////////////////
+static std::string ToMicroseconds(int64_t ns)
+{
+    char buffer[32];
+
+    std::snprintf(buffer, sizeof(buffer), "%.3f", ns / 1000.0);
+    return (buffer);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Write a Chrome trace JSON timeline
+///
+/// \param records
+/// \param out
+///
+///////////////////////////////////////////////////////////////////////////////
+static void WriteTrace(
+    const std::vector<Tracer::Record>& records,
+    std::ostream& out
+)
+{
+    std::map<uint32_t, std::string> processes;
+    int64_t origin = records.empty() ? 0 : records.front().begin;
+    bool first = true;
+
+    out << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+    for (const auto& record : records)
+    {
+        processes[record.pid] = GetProcessName(record);
+
+        out << (first ? "\n" : ",\n")
+            << "{\"name\":\""
+            << Tracer::GetEventName(static_cast<Tracer::Event>(record.event))
+            << "\",\"cat\":\"plazza\",\"ph\":\"X\""
+            << ",\"pid\":" << record.pid
+            << ",\"tid\":" << record.tid
+            << ",\"ts\":" << ToMicroseconds(record.begin - origin)
+            << ",\"dur\":" << ToMicroseconds(record.end - record.begin)
+            << ",\"args\":" << FormatArgs(record) << "}";
+        first = false;
+    }
+
+    for (const auto& [pid, name] : processes)
+    {
+        out << (first ? "\n" : ",\n")
+            << "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":" << pid
+            << ",\"args\":{\"name\":\"" << name << " (" << pid << ")\"}}";
+        first = false;
+    }
+    out << "\n]}\n";
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main(int argc, char* argv[])
+{
+    if (argc < 2 || argc > 3)
+    {
+        std::cerr << "Usage: " << argv[0] << " <trace_dir> [output.json]"
+                  << std::endl;
+        return (84);
+    }
+
+    try
+    {
+        std::vector<Tracer::Record> records = ReadRecords(argv[1]);
+
+        if (argc == 3)
+        {
+            std::ofstream out(argv[2]);
+            WriteTrace(records, out);
+        }
+        else
+        {
+            WriteTrace(records, std::cout);
+        }
+        std::cerr << records.size() << " event(s) merged" << std::endl;
+    }
+    catch (const std::exception& e)
+    {
+        std::cerr << e.what() << std::endl;
+        return (84);
+    }
+
+    return (0);
+}